@@ -0,0 +1,361 @@
+/**
+ * SignalForge Native Benchmarks
+ * Measures signalforge-core directly (no JSI, no JS engine) so native
+ * changes can be compared release to release
+ *
+ * Build and run:
+ *   cmake -S . -B build -DCMAKE_BUILD_TYPE=Release
+ *   cmake --build build --target signalforge-bench
+ *   ./build/src/native/signalforge-bench --json native-bench.json
+ *
+ * Options:
+ *   --sizes 1000,100000      signal counts to run (default 1k..1M)
+ *   --threads 1,2,4          thread counts to run (default 1 and hardware)
+ *   --repeat N               runs per scenario; median and best are reported
+ *   --full                   add the 10M signal scenario
+ *   --quick                  1k signals, 1 thread, 1 run (smoke test)
+ *   --json PATH              write results as JSON ("-" for stdout)
+ */
+
+#include "signalStore.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace signalforge;
+
+namespace {
+
+// Benchmark configuration
+constexpr size_t kMinOpsPerMeasurement = 1000000;  // Repeat cheap passes up to this
+constexpr size_t kBatchSize = 100;
+
+struct Options {
+    std::vector<size_t> sizes{1000, 10000, 100000, 1000000};
+    std::vector<size_t> threads;
+    size_t repeat = 3;
+    std::string jsonPath;
+};
+
+struct BenchmarkResult {
+    std::string op;
+    size_t signals;
+    size_t threads;
+    size_t ops;
+    double medianNsPerOp;
+    double bestNsPerOp;
+};
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Run body(threadIndex) on `threads` threads released together and return
+ * the wall time from release until the last one finishes
+ */
+double runParallel(size_t threads, const std::function<void(size_t)>& body) {
+    if (threads == 1) {
+        auto start = Clock::now();
+        body(0);
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            body(t);
+        });
+    }
+    while (ready.load() != threads) {
+        std::this_thread::yield();
+    }
+
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Half-open range of handles owned by one thread
+struct Range {
+    size_t begin;
+    size_t end;
+};
+
+Range partition(size_t count, size_t threads, size_t index) {
+    return {count * index / threads, count * (index + 1) / threads};
+}
+
+size_t passesFor(size_t signals) {
+    return std::max<size_t>(1, kMinOpsPerMeasurement / signals);
+}
+
+/**
+ * One full create/get/set/batch/subscribe/delete sequence against a
+ * cleared store; returns seconds per phase in a fixed order
+ */
+struct PhaseTimes {
+    double create, get, set, batch, subscribe, notify, remove;
+};
+
+PhaseTimes runScenario(size_t signals, size_t threads) {
+    JSISignalStore& store = JSISignalStore::getInstance();
+    store.clear();
+
+    std::vector<SignalHandle> handles(signals);
+    std::vector<std::shared_ptr<Signal>> signalRefs(signals);
+    size_t passes = passesFor(signals);
+    std::atomic<double> sink{0};
+    PhaseTimes times{};
+
+    times.create = runParallel(threads, [&](size_t t) {
+        Range range = partition(signals, threads, t);
+        for (size_t i = range.begin; i < range.end; i++) {
+            handles[i] = store.createSignalHandle(SignalValue(static_cast<double>(i)));
+        }
+    });
+
+    times.get = runParallel(threads, [&](size_t t) {
+        Range range = partition(signals, threads, t);
+        double sum = 0;
+        for (size_t pass = 0; pass < passes; pass++) {
+            for (size_t i = range.begin; i < range.end; i++) {
+                sum += store.getSignal(handles[i]).asNumber();
+            }
+        }
+        sink.store(sum, std::memory_order_relaxed);
+    });
+
+    times.set = runParallel(threads, [&](size_t t) {
+        Range range = partition(signals, threads, t);
+        for (size_t pass = 0; pass < passes; pass++) {
+            // Offset per pass so every write is a real change
+            double offset = static_cast<double>((pass + 1) * signals);
+            for (size_t i = range.begin; i < range.end; i++) {
+                store.setSignal(handles[i], SignalValue(offset + static_cast<double>(i)));
+            }
+        }
+    });
+
+    times.batch = runParallel(threads, [&](size_t t) {
+        Range range = partition(signals, threads, t);
+        std::vector<std::pair<SignalHandle, SignalValue>> updates;
+        updates.reserve(kBatchSize);
+        for (size_t pass = 0; pass < passes; pass++) {
+            double offset = -static_cast<double>((pass + 1) * signals);
+            for (size_t i = range.begin; i < range.end; i += kBatchSize) {
+                updates.clear();
+                size_t end = std::min(range.end, i + kBatchSize);
+                for (size_t j = i; j < end; j++) {
+                    updates.emplace_back(handles[j], SignalValue(offset - static_cast<double>(j)));
+                }
+                store.batchUpdate(updates);
+            }
+        }
+    });
+
+    std::atomic<size_t> notified{0};
+    times.subscribe = runParallel(threads, [&](size_t t) {
+        Range range = partition(signals, threads, t);
+        for (size_t i = range.begin; i < range.end; i++) {
+            signalRefs[i] = store.lookupSignal(handles[i]);
+            signalRefs[i]->subscribe([&notified](const SignalValue&) {
+                notified.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+    });
+
+    times.notify = runParallel(threads, [&](size_t t) {
+        Range range = partition(signals, threads, t);
+        for (size_t i = range.begin; i < range.end; i++) {
+            signalRefs[i]->setValue(SignalValue(0.5));
+        }
+    });
+    signalRefs.clear();
+
+    times.remove = runParallel(threads, [&](size_t t) {
+        Range range = partition(signals, threads, t);
+        for (size_t i = range.begin; i < range.end; i++) {
+            store.deleteSignal(handles[i]);
+        }
+    });
+
+    return times;
+}
+
+std::vector<size_t> parseList(const char* text) {
+    std::vector<size_t> values;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            values.push_back(static_cast<size_t>(std::strtoull(item.c_str(), nullptr, 10)));
+        }
+    }
+    return values;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--sizes" && hasValue) {
+            options.sizes = parseList(argv[++i]);
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = parseList(argv[++i]);
+        } else if (arg == "--repeat" && hasValue) {
+            options.repeat = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--json" && hasValue) {
+            options.jsonPath = argv[++i];
+        } else if (arg == "--full") {
+            options.sizes.push_back(10000000);
+        } else if (arg == "--quick") {
+            options.sizes = {1000};
+            options.threads = {1};
+            options.repeat = 1;
+        } else {
+            std::fprintf(stderr, "Unknown or incomplete option: %s\n", arg.c_str());
+            return false;
+        }
+    }
+
+    if (options.threads.empty()) {
+        size_t hardware = std::max<unsigned>(1, std::thread::hardware_concurrency());
+        options.threads.push_back(1);
+        if (hardware > 1) {
+            options.threads.push_back(hardware);
+        }
+    }
+    options.sizes.erase(std::remove(options.sizes.begin(), options.sizes.end(), 0), options.sizes.end());
+    options.threads.erase(std::remove(options.threads.begin(), options.threads.end(), 0), options.threads.end());
+    if (!SyncPolicy::kThreadSafe) {
+        // Single-threaded store: only one thread may touch it
+        options.threads.assign(1, 1);
+    }
+    return !options.sizes.empty() && !options.threads.empty();
+}
+
+BenchmarkResult summarize(const std::string& op, size_t signals, size_t threads,
+                          size_t ops, std::vector<double> seconds) {
+    std::sort(seconds.begin(), seconds.end());
+    double median = seconds[seconds.size() / 2];
+    return {op, signals, threads, ops, median * 1e9 / ops, seconds.front() * 1e9 / ops};
+}
+
+void writeJson(std::ostream& out, const std::vector<BenchmarkResult>& results, const Options& options) {
+    out << "{\n";
+    out << "  \"schema\": 1,\n";
+#if defined(__clang__)
+    out << "  \"compiler\": \"clang " << __clang_version__ << "\",\n";
+#elif defined(__GNUC__)
+    out << "  \"compiler\": \"gcc " << __VERSION__ << "\",\n";
+#else
+    out << "  \"compiler\": \"unknown\",\n";
+#endif
+#ifdef NDEBUG
+    out << "  \"optimized\": true,\n";
+#else
+    out << "  \"optimized\": false,\n";
+#endif
+    out << "  \"hardwareConcurrency\": " << std::thread::hardware_concurrency() << ",\n";
+    out << "  \"repeat\": " << options.repeat << ",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& r = results[i];
+        char line[256];
+        std::snprintf(line, sizeof(line),
+            "    {\"op\": \"%s\", \"signals\": %zu, \"threads\": %zu, \"ops\": %zu, "
+            "\"nsPerOp\": %.2f, \"bestNsPerOp\": %.2f, \"opsPerSec\": %.0f}%s\n",
+            r.op.c_str(), r.signals, r.threads, r.ops, r.medianNsPerOp, r.bestNsPerOp,
+            1e9 / r.medianNsPerOp, i + 1 < results.size() ? "," : "");
+        out << line;
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    // Keep stdout clean for JSON when it is the JSON destination
+    FILE* table = options.jsonPath == "-" ? stderr : stdout;
+    
+    std::vector<BenchmarkResult> results;
+    std::fprintf(table, "%-10s %10s %8s %12s %12s %14s\n", "op", "signals", "threads", "ns/op", "best ns/op", "ops/sec");
+
+    for (size_t signals : options.sizes) {
+        for (size_t threads : options.threads) {
+            size_t effectiveThreads = std::min(threads, signals);
+            std::vector<PhaseTimes> runs;
+            for (size_t rep = 0; rep < options.repeat; rep++) {
+                runs.push_back(runScenario(signals, effectiveThreads));
+            }
+
+            // batch is reported per write (kBatchSize writes per batchUpdate)
+            size_t passes = passesFor(signals);
+            struct Phase {
+                const char* op;
+                double PhaseTimes::*time;
+                size_t ops;
+            } phases[] = {
+                {"create", &PhaseTimes::create, signals},
+                {"get", &PhaseTimes::get, signals * passes},
+                {"set", &PhaseTimes::set, signals * passes},
+                {"batch", &PhaseTimes::batch, signals * passes},
+                {"subscribe", &PhaseTimes::subscribe, signals},
+                {"notify", &PhaseTimes::notify, signals},
+                {"delete", &PhaseTimes::remove, signals},
+            };
+
+            for (const Phase& phase : phases) {
+                std::vector<double> seconds;
+                for (const PhaseTimes& run : runs) {
+                    seconds.push_back(run.*phase.time);
+                }
+                BenchmarkResult result = summarize(phase.op, signals, effectiveThreads, phase.ops, seconds);
+                std::fprintf(table, "%-10s %10zu %8zu %12.1f %12.1f %14.0f\n",
+                    result.op.c_str(), result.signals, result.threads,
+                    result.medianNsPerOp, result.bestNsPerOp, 1e9 / result.medianNsPerOp);
+                results.push_back(result);
+            }
+        }
+    }
+
+    JSISignalStore::getInstance().clear();
+
+    if (options.jsonPath == "-") {
+        writeJson(std::cout, results, options);
+    } else if (!options.jsonPath.empty()) {
+        std::ofstream file(options.jsonPath);
+        if (!file) {
+            std::fprintf(stderr, "Cannot write %s\n", options.jsonPath.c_str());
+            return 1;
+        }
+        writeJson(file, results, options);
+    }
+    return 0;
+}
@@ -0,0 +1,358 @@
+/**
+ * SignalForge Native Contention Benchmark
+ * Mixed reader / writer / subscriber threads hammering a shared store with
+ * Zipfian signal popularity (a few hot signals, a long cold tail), which
+ * is what native producer threads feeding a UI look like. Reports
+ * throughput, p50/p99/p999 latency per operation and time spent blocked
+ * on each family of locks
+ *
+ * Build and run:
+ *   cmake -S . -B build -DCMAKE_BUILD_TYPE=Release
+ *   cmake --build build --target signalforge-contention
+ *   ./build/src/native/signalforge-contention --threads 1,2,4,8 --json contention.json
+ *
+ * Options:
+ *   --signals N              signals in the store (default 10000)
+ *   --threads 1,2,4          thread counts to run (default 1, 2, 4, hardware)
+ *   --mix R,W,S              percent reads, writes, subscribe/unsubscribe (default 80,18,2)
+ *   --zipf S                 Zipf exponent; 0 = uniform (default 0.99)
+ *   --duration-ms N          measured time per thread count (default 1000)
+ *   --json PATH              write results as JSON ("-" for stdout)
+ */
+
+#include "signalStore.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace signalforge;
+
+namespace {
+
+// Per-thread latency samples kept (older samples are overwritten round-robin)
+constexpr size_t kMaxSamplesPerThread = 1 << 20;
+
+enum Op { Read, Write, Subscribe, OpCount };
+constexpr const char* kOpNames[OpCount] = {"read", "write", "subscribe"};
+
+constexpr LockSite kLockSites[] = {LockSite::Shard, LockSite::Signal, LockSite::Pool};
+constexpr const char* kLockSiteNames[] = {"shard", "signal", "pool"};
+
+struct Options {
+    size_t signals = 10000;
+    std::vector<size_t> threads;
+    unsigned mix[OpCount] = {80, 18, 2};
+    double zipf = 0.99;
+    size_t durationMs = 1000;
+    std::string jsonPath;
+};
+
+/**
+ * ZipfSampler - draws ranks 0..n-1 with P(k) proportional to 1/(k+1)^s
+ * The CDF is precomputed once and shared; sampling is a binary search
+ */
+class ZipfSampler {
+public:
+    ZipfSampler(size_t n, double exponent) : cdf_(n) {
+        double total = 0;
+        for (size_t k = 0; k < n; k++) {
+            total += 1.0 / std::pow(static_cast<double>(k + 1), exponent);
+            cdf_[k] = total;
+        }
+        for (double& value : cdf_) {
+            value /= total;
+        }
+    }
+
+    size_t sample(double uniform) const {
+        auto it = std::lower_bound(cdf_.begin(), cdf_.end(), uniform);
+        return std::min(static_cast<size_t>(it - cdf_.begin()), cdf_.size() - 1);
+    }
+
+private:
+    std::vector<double> cdf_;
+};
+
+struct ThreadResult {
+    uint64_t ops[OpCount] = {};
+    std::vector<uint32_t> samples[OpCount];
+};
+
+struct OpSummary {
+    uint64_t ops;
+    double opsPerSec;
+    double p50, p99, p999;  // Nanoseconds
+};
+
+struct RunResult {
+    size_t threads;
+    double seconds;
+    OpSummary ops[OpCount];
+    LockStats locks[sizeof(kLockSites) / sizeof(kLockSites[0])];
+};
+
+double percentile(std::vector<uint32_t>& samples, double fraction) {
+    if (samples.empty()) {
+        return 0;
+    }
+    size_t index = std::min(samples.size() - 1, static_cast<size_t>(fraction * samples.size()));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+/**
+ * One measured run: every thread draws operations from the configured mix
+ * against Zipf-chosen signals until the deadline
+ */
+RunResult runContention(const Options& options, const std::vector<SignalHandle>& handles,
+                        const ZipfSampler& zipf, size_t threads) {
+    std::vector<ThreadResult> perThread(threads);
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> go{false};
+    std::atomic<bool> stop{false};
+    unsigned readCut = options.mix[Read];
+    unsigned writeCut = readCut + options.mix[Write];
+    unsigned totalMix = writeCut + options.mix[Subscribe];
+
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            JSISignalStore& store = JSISignalStore::getInstance();
+            ThreadResult& result = perThread[t];
+            for (auto& samples : result.samples) {
+                samples.reserve(kMaxSamplesPerThread);
+            }
+            std::mt19937_64 rng(0x9E3779B97F4A7C15ull * (t + 1));
+            std::uniform_real_distribution<double> uniform(0.0, 1.0);
+            std::uniform_int_distribution<unsigned> pick(0, totalMix - 1);
+            double counter = static_cast<double>(t) * 1e12;
+
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+
+            while (!stop.load(std::memory_order_relaxed)) {
+                SignalHandle handle = handles[zipf.sample(uniform(rng))];
+                unsigned roll = pick(rng);
+                Op op = roll < readCut ? Read : roll < writeCut ? Write : Subscribe;
+
+                auto start = std::chrono::steady_clock::now();
+                if (op == Read) {
+                    store.getSignal(handle);
+                } else if (op == Write) {
+                    store.setSignal(handle, SignalValue(counter += 1));
+                } else {
+                    std::shared_ptr<Signal> signal = store.lookupSignal(handle);
+                    size_t id = signal->subscribe([](const SignalValue&) {});
+                    signal->unsubscribe(id);
+                }
+                auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+
+                uint32_t sample = static_cast<uint32_t>(std::min<int64_t>(elapsed, UINT32_MAX));
+                auto& samples = result.samples[op];
+                if (samples.size() < kMaxSamplesPerThread) {
+                    samples.push_back(sample);
+                } else {
+                    samples[result.ops[op] % kMaxSamplesPerThread] = sample;
+                }
+                result.ops[op]++;
+            }
+        });
+    }
+
+    while (ready.load() != threads) {
+        std::this_thread::yield();
+    }
+    resetLockStats();
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::milliseconds(options.durationMs));
+    stop.store(true);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    RunResult run{};
+    run.threads = threads;
+    run.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (size_t i = 0; i < sizeof(kLockSites) / sizeof(kLockSites[0]); i++) {
+        run.locks[i] = getLockStats(kLockSites[i]);
+    }
+
+    for (int op = 0; op < OpCount; op++) {
+        std::vector<uint32_t> merged;
+        uint64_t total = 0;
+        for (ThreadResult& result : perThread) {
+            total += result.ops[op];
+            merged.insert(merged.end(), result.samples[op].begin(), result.samples[op].end());
+        }
+        OpSummary& summary = run.ops[op];
+        summary.ops = total;
+        summary.opsPerSec = total / run.seconds;
+        summary.p50 = percentile(merged, 0.50);
+        summary.p99 = percentile(merged, 0.99);
+        summary.p999 = percentile(merged, 0.999);
+    }
+    return run;
+}
+
+std::vector<size_t> parseList(const char* text) {
+    std::vector<size_t> values;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            values.push_back(static_cast<size_t>(std::strtoull(item.c_str(), nullptr, 10)));
+        }
+    }
+    return values;
+}
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--signals" && hasValue) {
+            options.signals = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = parseList(argv[++i]);
+        } else if (arg == "--mix" && hasValue) {
+            std::vector<size_t> mix = parseList(argv[++i]);
+            if (mix.size() != OpCount) {
+                std::fprintf(stderr, "--mix expects reads,writes,subscribes\n");
+                return false;
+            }
+            for (int op = 0; op < OpCount; op++) {
+                options.mix[op] = static_cast<unsigned>(mix[op]);
+            }
+        } else if (arg == "--zipf" && hasValue) {
+            options.zipf = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--duration-ms" && hasValue) {
+            options.durationMs = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--json" && hasValue) {
+            options.jsonPath = argv[++i];
+        } else {
+            std::fprintf(stderr, "Unknown or incomplete option: %s\n", arg.c_str());
+            return false;
+        }
+    }
+
+    if (options.threads.empty()) {
+        size_t hardware = std::max<unsigned>(1, std::thread::hardware_concurrency());
+        for (size_t count : {size_t(1), size_t(2), size_t(4), hardware}) {
+            if (std::find(options.threads.begin(), options.threads.end(), count) == options.threads.end()) {
+                options.threads.push_back(count);
+            }
+        }
+    }
+    options.threads.erase(std::remove(options.threads.begin(), options.threads.end(), 0), options.threads.end());
+    return options.signals > 0 && !options.threads.empty() &&
+           options.mix[Read] + options.mix[Write] + options.mix[Subscribe] > 0;
+}
+
+void writeJson(std::ostream& out, const std::vector<RunResult>& runs, const Options& options) {
+    char line[512];
+    out << "{\n";
+    out << "  \"schema\": 1,\n";
+    out << "  \"hardwareConcurrency\": " << std::thread::hardware_concurrency() << ",\n";
+    std::snprintf(line, sizeof(line),
+        "  \"config\": {\"signals\": %zu, \"mix\": [%u, %u, %u], \"zipf\": %.3f, \"durationMs\": %zu},\n",
+        options.signals, options.mix[Read], options.mix[Write], options.mix[Subscribe],
+        options.zipf, options.durationMs);
+    out << line;
+    out << "  \"runs\": [\n";
+    for (size_t r = 0; r < runs.size(); r++) {
+        const RunResult& run = runs[r];
+        out << "    {\"threads\": " << run.threads << ", \"ops\": {";
+        for (int op = 0; op < OpCount; op++) {
+            const OpSummary& s = run.ops[op];
+            std::snprintf(line, sizeof(line),
+                "%s\"%s\": {\"count\": %llu, \"opsPerSec\": %.0f, \"p50Ns\": %.0f, \"p99Ns\": %.0f, \"p999Ns\": %.0f}",
+                op ? ", " : "", kOpNames[op], static_cast<unsigned long long>(s.ops),
+                s.opsPerSec, s.p50, s.p99, s.p999);
+            out << line;
+        }
+        out << "}, \"locks\": {";
+        for (size_t i = 0; i < sizeof(kLockSites) / sizeof(kLockSites[0]); i++) {
+            std::snprintf(line, sizeof(line), "%s\"%s\": {\"contended\": %llu, \"waitMs\": %.3f}",
+                i ? ", " : "", kLockSiteNames[i],
+                static_cast<unsigned long long>(run.locks[i].contended), run.locks[i].waitNanos / 1e6);
+            out << line;
+        }
+        out << "}}" << (r + 1 < runs.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        return 2;
+    }
+
+    JSISignalStore& store = JSISignalStore::getInstance();
+    store.clear();
+    std::vector<SignalHandle> handles;
+    handles.reserve(options.signals);
+    for (size_t i = 0; i < options.signals; i++) {
+        handles.push_back(store.createSignalHandle(SignalValue(static_cast<double>(i))));
+        // One resident subscriber so writes pay for a notification
+        store.lookupSignal(handles.back())->subscribe([](const SignalValue&) {});
+    }
+    ZipfSampler zipf(options.signals, options.zipf);
+
+    // Keep stdout clean for JSON when it is the JSON destination
+    FILE* table = options.jsonPath == "-" ? stderr : stdout;
+    std::fprintf(table, "%zu signals, mix %u/%u/%u (read/write/subscribe), zipf %.2f, %zums per run\n\n",
+        options.signals, options.mix[Read], options.mix[Write], options.mix[Subscribe],
+        options.zipf, options.durationMs);
+    std::fprintf(table, "%7s %-10s %14s %9s %9s %9s\n", "threads", "op", "ops/sec", "p50 ns", "p99 ns", "p999 ns");
+
+    std::vector<RunResult> runs;
+    for (size_t threads : options.threads) {
+        RunResult run = runContention(options, handles, zipf, threads);
+        for (int op = 0; op < OpCount; op++) {
+            const OpSummary& s = run.ops[op];
+            std::fprintf(table, "%7zu %-10s %14.0f %9.0f %9.0f %9.0f\n",
+                threads, kOpNames[op], s.opsPerSec, s.p50, s.p99, s.p999);
+        }
+        for (size_t i = 0; i < sizeof(kLockSites) / sizeof(kLockSites[0]); i++) {
+            // Wait as a share of all thread time in the run
+            double waitShare = run.locks[i].waitNanos / (run.seconds * 1e9 * threads) * 100.0;
+            std::fprintf(table, "%7s lock %-5s %9llu contended  %10.3f ms waited (%.2f%% of thread time)\n",
+                "", kLockSiteNames[i], static_cast<unsigned long long>(run.locks[i].contended),
+                run.locks[i].waitNanos / 1e6, waitShare);
+        }
+        runs.push_back(run);
+    }
+
+    store.clear();
+
+    if (options.jsonPath == "-") {
+        writeJson(std::cout, runs, options);
+    } else if (!options.jsonPath.empty()) {
+        std::ofstream file(options.jsonPath);
+        if (!file) {
+            std::fprintf(stderr, "Cannot write %s\n", options.jsonPath.c_str());
+            return 1;
+        }
+        writeJson(file, runs, options);
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace signalforge {
+
+/**
+ * ChunkedBuffer - index-addressed array of atomics shared with JS
+ * Storage grows in fixed chunks of kChunkSize elements that are allocated
+ * on first use and never move, so a JS typed array over a chunk (and any
+ * native pointer into it) stays valid for the chunk's lifetime. Chunks are
+ * reference counted: JS ArrayBuffers keep theirs alive independently of
+ * the owning store
+ *
+ * Element lookup is lock-free once a chunk exists; only allocating a new
+ * chunk takes the mutex
+ */
+template <typename Atomic, uint32_t ChunkShift, uint32_t MaxChunks>
+class ChunkedBuffer {
+public:
+    static constexpr uint32_t kChunkShift = ChunkShift;
+    static constexpr uint32_t kChunkSize = 1u << ChunkShift;
+    static constexpr uint32_t kMaxChunks = MaxChunks;
+    static constexpr uint64_t kCapacity = static_cast<uint64_t>(kChunkSize) * kMaxChunks;
+
+    using Value = typename Atomic::value_type;
+
+    static_assert(sizeof(Atomic) == sizeof(Value) && Atomic::is_always_lock_free,
+                  "Chunk elements must be plain lock-free values JS can read in place");
+
+    struct Chunk {
+        Atomic items[kChunkSize];
+    };
+
+    ChunkedBuffer() {
+        for (auto& chunk : index_) {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ChunkedBuffer(const ChunkedBuffer&) = delete;
+    ChunkedBuffer& operator=(const ChunkedBuffer&) = delete;
+
+    // Element i, allocating (zero-filled) its chunk if needed; nullptr
+    // past kCapacity
+    Atomic* at(uint64_t i) {
+        if (i >= kCapacity) {
+            return nullptr;
+        }
+        uint32_t chunkIndex = static_cast<uint32_t>(i >> kChunkShift);
+        Chunk* chunk = index_[chunkIndex].load(std::memory_order_acquire);
+        if (!chunk) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::shared_ptr<Chunk>& owner = owners_[chunkIndex];
+            if (!owner) {
+                owner = std::make_shared<Chunk>();
+                for (auto& item : owner->items) {
+                    item.store(Value{}, std::memory_order_relaxed);
+                }
+                index_[chunkIndex].store(owner.get(), std::memory_order_release);
+            }
+            chunk = owner.get();
+        }
+        return &chunk->items[i & (kChunkSize - 1)];
+    }
+
+    // Allocated chunk, or nullptr when nothing in its range was touched yet
+    std::shared_ptr<Chunk> chunk(uint32_t chunkIndex) const {
+        if (chunkIndex >= kMaxChunks) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        return owners_[chunkIndex];
+    }
+
+private:
+    mutable std::mutex mutex_;  // Guards chunk allocation
+    std::shared_ptr<Chunk> owners_[kMaxChunks];
+    std::atomic<Chunk*> index_[kMaxChunks];  // Lock-free view of owners_
+};
+
+} // namespace signalforge
@@ -0,0 +1,144 @@
+#include "coalescedNotifier.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace signalforge {
+
+struct CoalescedNotifier::Queue {
+    std::mutex mutex;
+    std::vector<uint64_t> order;                       // First change per id, in order
+    std::unordered_map<uint64_t, SignalValue> latest;  // Newest value per id
+    bool flushScheduled = false;
+
+    Scheduler scheduler;
+    std::weak_ptr<Consumer> consumer;  // Target of scheduled flushes
+};
+
+struct CoalescedNotifier::Consumer {
+    struct Subscription {
+        std::shared_ptr<Signal> signal;
+        size_t signalSubscription;
+        Listener listener;
+        bool active = true;
+    };
+
+    std::shared_ptr<Queue> queue;
+    std::unordered_map<uint64_t, std::shared_ptr<Subscription>> subscriptions;
+    uint64_t nextId = 1;
+
+    /**
+     * Take everything queued so far and run each listener once with its
+     * latest value. Changes arriving meanwhile schedule the next flush
+     */
+    void flush() {
+        std::vector<uint64_t> order;
+        std::unordered_map<uint64_t, SignalValue> latest;
+        {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            order.swap(queue->order);
+            latest.swap(queue->latest);
+            queue->flushScheduled = false;
+        }
+
+        // Resolve first: listeners may (un)subscribe while we deliver
+        std::vector<std::pair<std::shared_ptr<Subscription>, SignalValue*>> deliveries;
+        deliveries.reserve(order.size());
+        for (uint64_t id : order) {
+            auto it = subscriptions.find(id);
+            if (it != subscriptions.end()) {
+                deliveries.emplace_back(it->second, &latest[id]);
+            }
+        }
+        for (const auto& [subscription, value] : deliveries) {
+            if (!subscription->active) {
+                continue;  // Unsubscribed by an earlier listener in this flush
+            }
+            try {
+                subscription->listener(*value);
+            } catch (...) {
+                // Swallow exceptions to prevent one listener from breaking others
+            }
+        }
+    }
+};
+
+CoalescedNotifier::CoalescedNotifier(Scheduler scheduler)
+    : consumer_(std::make_shared<Consumer>()) {
+    consumer_->queue = std::make_shared<Queue>();
+    consumer_->queue->scheduler = std::move(scheduler);
+    consumer_->queue->consumer = consumer_;
+}
+
+/**
+ * Unhook every subscription; scheduled flushes find nothing to run
+ */
+CoalescedNotifier::~CoalescedNotifier() {
+    for (const auto& [id, subscription] : consumer_->subscriptions) {
+        subscription->active = false;
+        subscription->signal->unsubscribe(subscription->signalSubscription);
+    }
+}
+
+/**
+ * Route a signal's changes to listener on the consumer thread
+ * The Signal callback only holds the queue weakly and never touches the
+ * listener, so it is safe on any producer thread
+ */
+uint64_t CoalescedNotifier::subscribe(std::shared_ptr<Signal> signal, Listener listener) {
+    uint64_t id = consumer_->nextId++;
+    std::weak_ptr<Queue> weakQueue(consumer_->queue);
+
+    auto subscription = std::make_shared<Consumer::Subscription>();
+    subscription->signal = std::move(signal);
+    subscription->listener = std::move(listener);
+    subscription->signalSubscription = subscription->signal->subscribe(
+        [weakQueue, id](const SignalValue& value) {
+            auto queue = weakQueue.lock();
+            if (!queue) {
+                return;
+            }
+            bool schedule;
+            {
+                std::lock_guard<std::mutex> lock(queue->mutex);
+                if (queue->latest.insert_or_assign(id, value).second) {
+                    queue->order.push_back(id);
+                }
+                schedule = !queue->flushScheduled;
+                queue->flushScheduled = true;
+            }
+            if (schedule) {
+                queue->scheduler([weakConsumer = queue->consumer] {
+                    if (auto consumer = weakConsumer.lock()) {
+                        consumer->flush();
+                    }
+                });
+            }
+        });
+
+    consumer_->subscriptions.emplace(id, std::move(subscription));
+    return id;
+}
+
+bool CoalescedNotifier::unsubscribe(uint64_t id) {
+    auto it = consumer_->subscriptions.find(id);
+    if (it == consumer_->subscriptions.end()) {
+        return false;
+    }
+    it->second->active = false;
+    it->second->signal->unsubscribe(it->second->signalSubscription);
+    consumer_->subscriptions.erase(it);
+    return true;
+}
+
+void CoalescedNotifier::flush() {
+    consumer_->flush();
+}
+
+size_t CoalescedNotifier::getSubscriptionCount() const {
+    return consumer_->subscriptions.size();
+}
+
+} // namespace signalforge
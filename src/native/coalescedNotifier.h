@@ -0,0 +1,56 @@
+#pragma once
+
+#include "signalStore.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace signalforge {
+
+/**
+ * CoalescedNotifier - delivers signal changes to a single consumer thread
+ *
+ * Signal callbacks run on whichever thread wrote the signal. A notifier
+ * instead records the change (latest value per subscription) and asks its
+ * scheduler to run one flush on the consumer thread; every change that
+ * lands before that flush runs is delivered by it. A burst of writes from
+ * native threads therefore costs the consumer one task per tick, and each
+ * listener sees only the newest value
+ *
+ * The JSI layer schedules flushes through React Native's CallInvoker so
+ * listeners (JS functions) always run on the JS thread. Listeners are
+ * only ever called, copied and destroyed on the consumer thread: subscribe,
+ * unsubscribe and flush must be called from it too
+ */
+class CoalescedNotifier {
+public:
+    // Runs a task on the consumer thread (e.g. CallInvoker::invokeAsync)
+    using Scheduler = std::function<void(std::function<void()>)>;
+    using Listener = std::function<void(const SignalValue&)>;
+
+    explicit CoalescedNotifier(Scheduler scheduler);
+    ~CoalescedNotifier();
+
+    CoalescedNotifier(const CoalescedNotifier&) = delete;
+    CoalescedNotifier& operator=(const CoalescedNotifier&) = delete;
+
+    // Subscription ids are never reused; 0 is never issued
+    uint64_t subscribe(std::shared_ptr<Signal> signal, Listener listener);
+    // Returns false for unknown ids; a pending change is dropped
+    bool unsubscribe(uint64_t id);
+
+    // Deliver pending changes now (normally run by the scheduler)
+    void flush();
+
+    size_t getSubscriptionCount() const;
+
+private:
+    struct Queue;     // Producer-facing change queue
+    struct Consumer;  // Subscriptions and listeners (consumer thread only)
+
+    // Held strongly only here and, for the length of a flush, by the
+    // flush task, so listeners are destroyed on the consumer thread
+    std::shared_ptr<Consumer> consumer_;
+};
+
+} // namespace signalforge
@@ -0,0 +1,217 @@
+#include "computedGraph.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace signalforge {
+
+ComputedNode::ComputedNode(ComputedGraph& graph, std::vector<std::shared_ptr<Signal>> inputs,
+                           ComputeFunction compute)
+    : graph(graph),
+      signal(nullptr),
+      compute(std::move(compute)),
+      inputs(std::move(inputs)),
+      stale(true),
+      initialized(false),
+      linked(false) {}
+
+/**
+ * Hook the node up to its inputs, then compute its first value
+ * Plain inputs notify through a subscription (holding the node weakly, so
+ * a notification racing unlink is harmless); computed inputs list the
+ * node as a dependent
+ */
+void ComputedGraph::link(ComputedNode& node) {
+    PendingNotifications pending;
+    std::exception_ptr error;
+    {
+        std::lock_guard<Mutex> lock(mutex_);
+        std::weak_ptr<ComputedNode> weak(node.signal->computed_);
+
+        node.subscriptions.assign(node.inputs.size(), 0);
+        for (size_t i = 0; i < node.inputs.size(); ++i) {
+            Signal& input = *node.inputs[i];
+            if (input.computed_) {
+                input.computed_->dependents.push_back(&node);
+            } else {
+                node.subscriptions[i] = input.subscribe([this, weak](const SignalValue&) {
+                    if (auto target = weak.lock()) {
+                        invalidate(*target);
+                    }
+                });
+            }
+        }
+        node.linked = true;
+
+        try {
+            refreshLocked(node, pending);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    deliver(pending);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * Detach the node from its inputs
+ * Dependents still holding the node keep reading its last value
+ */
+void ComputedGraph::unlink(ComputedNode& node) {
+    std::lock_guard<Mutex> lock(mutex_);
+    if (!node.linked) {
+        return;
+    }
+    node.linked = false;
+
+    for (size_t i = 0; i < node.inputs.size(); ++i) {
+        Signal& input = *node.inputs[i];
+        if (input.computed_) {
+            auto& dependents = input.computed_->dependents;
+            dependents.erase(std::remove(dependents.begin(), dependents.end(), &node), dependents.end());
+        } else {
+            input.unsubscribe(node.subscriptions[i]);
+        }
+    }
+}
+
+/**
+ * Read-path refresh; the stale flag was already seen set
+ */
+void ComputedGraph::refresh(ComputedNode& node) {
+    PendingNotifications pending;
+    std::exception_ptr error;
+    {
+        std::lock_guard<Mutex> lock(mutex_);
+        try {
+            refreshLocked(node, pending);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+    deliver(pending);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * A plain input of node changed: mark everything downstream stale, then
+ * recompute the observed part of it
+ * Compute errors are left for the next reader (the node stays stale)
+ */
+void ComputedGraph::invalidate(ComputedNode& node) {
+    PendingNotifications pending;
+    {
+        std::lock_guard<Mutex> lock(mutex_);
+        if (!node.linked) {
+            return;
+        }
+
+        std::vector<ComputedNode*> observed;
+        markStale(node, observed);
+        for (ComputedNode* target : observed) {
+            try {
+                refreshLocked(*target, pending);
+            } catch (...) {
+                // Rethrown to whoever reads the node next
+            }
+        }
+    }
+    deliver(pending);
+}
+
+/**
+ * Mark node and its dependents stale, collecting nodes with subscribers
+ * A node that is already stale has stale dependents too, so the walk
+ * stops there
+ * Caller must hold mutex_
+ */
+void ComputedGraph::markStale(ComputedNode& node, std::vector<ComputedNode*>& observed) {
+    if (node.stale.load(std::memory_order_relaxed)) {
+        return;
+    }
+    node.stale.store(true, std::memory_order_release);
+
+    Signal& signal = *node.signal;
+    {
+        std::lock_guard<Signal::Mutex> lock(signal.mutex_);
+        if (signal.versionCounter_) {
+            signal.versionCounter_->fetch_add(1, std::memory_order_release);
+        }
+        if (!signal.subscribers_->empty()) {
+            observed.push_back(&node);
+        }
+    }
+
+    for (ComputedNode* dependent : node.dependents) {
+        markStale(*dependent, observed);
+    }
+}
+
+/**
+ * Bring node up to date: refresh computed inputs first, then recompute
+ * only if an input version moved since the last compute
+ * Caller must hold mutex_
+ */
+void ComputedGraph::refreshLocked(ComputedNode& node, PendingNotifications& pending) {
+    if (!node.stale.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    bool changed = !node.initialized;
+    for (size_t i = 0; i < node.inputs.size(); ++i) {
+        Signal& input = *node.inputs[i];
+        if (input.computed_) {
+            refreshLocked(*input.computed_, pending);
+        }
+        if (!changed && input.loadVersion() != node.inputVersions[i]) {
+            changed = true;
+        }
+    }
+    if (!changed) {
+        node.stale.store(false, std::memory_order_release);
+        return;
+    }
+
+    // Versions are read before values: a write landing in between is
+    // picked up by the next refresh instead of being missed
+    std::vector<uint64_t> versions(node.inputs.size());
+    std::vector<SignalValue> values;
+    values.reserve(node.inputs.size());
+    for (size_t i = 0; i < node.inputs.size(); ++i) {
+        versions[i] = node.inputs[i]->loadVersion();
+        values.push_back(node.inputs[i]->loadValue());
+    }
+    SignalValue result = node.compute(values);
+
+    node.inputVersions = std::move(versions);
+    Signal& signal = *node.signal;
+    {
+        std::lock_guard<Signal::Mutex> lock(signal.mutex_);
+        if (!node.initialized) {
+            // The first value is the signal's initial value (version 0)
+            signal.publish(result);
+        } else if (auto subscribers = signal.commit(result)) {
+            if (!subscribers->empty()) {
+                pending.emplace_back(std::move(subscribers), result);
+            }
+        }
+    }
+    node.initialized = true;
+    node.stale.store(false, std::memory_order_release);
+}
+
+/**
+ * Run subscriber callbacks for committed recomputations
+ * Must be called without holding mutex_: callbacks may write signals
+ */
+void ComputedGraph::deliver(const PendingNotifications& pending) {
+    for (const auto& [subscribers, value] : pending) {
+        Signal::notify(*subscribers, value);
+    }
+}
+
+} // namespace signalforge
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "lockStats.h"
+#include "signalStore.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace signalforge {
+
+class ComputedGraph;
+
+/**
+ * ComputedNode - graph state of one computed signal
+ * Owned by its Signal (Signal::computed_). Inputs are held strongly, in
+ * argument order, so a node can always recompute; dependents are the
+ * computed nodes reading this one and are unhooked when they leave the
+ * store
+ */
+struct ComputedNode {
+    ComputedNode(ComputedGraph& graph, std::vector<std::shared_ptr<Signal>> inputs,
+                 ComputeFunction compute);
+
+    ComputedGraph& graph;
+    Signal* signal;  // Owning signal, set before the node is linked
+    const ComputeFunction compute;
+    const std::vector<std::shared_ptr<Signal>> inputs;
+
+    // Everything below is guarded by the graph mutex, except that stale
+    // is also read lock-free as the clean-read fast path
+    SyncPolicy::Atomic<bool> stale;
+    bool initialized;                      // Computed at least once
+    bool linked;                           // Receiving invalidations
+    std::vector<uint64_t> inputVersions;   // Input versions seen by the last compute
+    std::vector<size_t> subscriptions;     // Per input: subscription id on plain inputs
+    std::vector<ComputedNode*> dependents;
+};
+
+/**
+ * ComputedGraph - push-pull propagation for native computed signals
+ *
+ * Push: a write to a plain input marks its computed dependents stale and
+ * walks downstream once (nodes already stale stop the walk). Stale nodes
+ * bump their slot's version counter so JS change detection sees them
+ *
+ * Pull: a stale node is recomputed when it is read. Its computed inputs
+ * are refreshed first (depth first, i.e. topological order) and the node
+ * only recomputes if some input version moved; a recomputed value equal
+ * to the previous one (SignalValue equality) doesn't bump the version, so
+ * unchanged intermediate results cut propagation off
+ *
+ * Nodes with subscribers are refreshed eagerly right after the write that
+ * invalidated them, so their callbacks fire without anyone reading.
+ * Everything else stays lazy
+ *
+ * Edges are fixed at creation and inputs must already exist, so the graph
+ * is acyclic by construction. Compute functions run under the graph mutex
+ * and must not call back into the store
+ */
+class ComputedGraph {
+public:
+    ComputedGraph() = default;
+    ComputedGraph(const ComputedGraph&) = delete;
+    ComputedGraph& operator=(const ComputedGraph&) = delete;
+
+    // Start receiving invalidations and compute the initial value
+    void link(ComputedNode& node);
+    // Stop receiving invalidations (the node keeps its last value)
+    void unlink(ComputedNode& node);
+
+    // Bring a stale node up to date (Signal read path)
+    void refresh(ComputedNode& node);
+
+private:
+    using Mutex = SyncPolicy::Mutex<LockSite::Graph>;
+
+    // Committed changes whose subscribers run after the mutex is released
+    using PendingNotifications =
+        std::vector<std::pair<std::shared_ptr<const Signal::SubscriberList>, SignalValue>>;
+
+    Mutex mutex_;
+
+    void invalidate(ComputedNode& node);
+    void markStale(ComputedNode& node, std::vector<ComputedNode*>& observed);
+    void refreshLocked(ComputedNode& node, PendingNotifications& pending);
+    static void deliver(const PendingNotifications& pending);
+};
+
+} // namespace signalforge
@@ -0,0 +1,962 @@
+#include "expression.h"
+
+#include <charconv>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+namespace signalforge {
+
+// ============================================================================
+// JS Conversions
+// ============================================================================
+
+namespace {
+
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+/**
+ * Number::toString: shortest round-trip digits, laid out like JS
+ * (fixed notation for exponents in [-7, 21), exponential otherwise)
+ */
+std::string formatNumber(double number) {
+    if (std::isnan(number)) {
+        return "NaN";
+    }
+    if (std::isinf(number)) {
+        return number > 0 ? "Infinity" : "-Infinity";
+    }
+    if (number == 0) {
+        return "0";
+    }
+
+    char buffer[32];
+    for (int precision = 1; precision <= 17; ++precision) {
+        std::snprintf(buffer, sizeof(buffer), "%.*e", precision - 1, number);
+        if (std::strtod(buffer, nullptr) == number) {
+            break;
+        }
+    }
+
+    // buffer is "[-]d.ddde[+-]xx": split into digits and decimal exponent
+    std::string result;
+    const char* p = buffer;
+    if (*p == '-') {
+        result.push_back('-');
+        ++p;
+    }
+    std::string digits;
+    for (; *p != 'e'; ++p) {
+        if (*p != '.') {
+            digits.push_back(*p);
+        }
+    }
+    int exponent = std::atoi(p + 1) + 1;  // Position of the decimal point
+    while (digits.size() > 1 && digits.back() == '0') {
+        digits.pop_back();
+    }
+    int length = static_cast<int>(digits.size());
+
+    if (length <= exponent && exponent <= 21) {
+        result += digits;
+        result.append(static_cast<size_t>(exponent - length), '0');
+    } else if (0 < exponent && exponent <= 21) {
+        result += digits.substr(0, static_cast<size_t>(exponent));
+        result.push_back('.');
+        result += digits.substr(static_cast<size_t>(exponent));
+    } else if (-6 < exponent && exponent <= 0) {
+        result += "0.";
+        result.append(static_cast<size_t>(-exponent), '0');
+        result += digits;
+    } else {
+        result.push_back(digits[0]);
+        if (length > 1) {
+            result.push_back('.');
+            result += digits.substr(1);
+        }
+        result.push_back('e');
+        result.push_back(exponent - 1 >= 0 ? '+' : '-');
+        result += std::to_string(std::abs(exponent - 1));
+    }
+    return result;
+}
+
+bool isWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+}
+
+bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * Convert a validated decimal literal (digits, '.', exponent; no sign)
+ * from_chars ignores the locale; where the standard library lacks it for
+ * doubles, and for out-of-range literals (which it leaves unconverted),
+ * strtod is given the literal with the C locale's decimal point
+ */
+double decimalToDouble(std::string_view literal) {
+#if defined(__cpp_lib_to_chars)
+    double result = 0;
+    auto [end, error] = std::from_chars(literal.data(), literal.data() + literal.size(), result);
+    if (error == std::errc() && end == literal.data() + literal.size()) {
+        return result;
+    }
+#endif
+    std::string buffer(literal);
+    const char* point = std::localeconv()->decimal_point;
+    size_t dot = buffer.find('.');
+    if (dot != std::string::npos && point && std::string_view(point) != ".") {
+        buffer.replace(dot, 1, point);
+    }
+    return std::strtod(buffer.c_str(), nullptr);  // Overflow gives HUGE_VAL (Infinity)
+}
+
+/**
+ * Scan the JS numeric literal at the start of text and convert it:
+ * decimal with optional fraction and exponent, or a 0x / 0o / 0b integer.
+ * Returns its length, 0 when text doesn't start with one. Leading zeros
+ * ("012") are only accepted with leadingZeros, as string conversion does;
+ * source literals reject them like strict mode
+ */
+size_t scanNumber(std::string_view text, bool leadingZeros, double& value) {
+    if (text.size() > 2 && text[0] == '0') {
+        char prefix = static_cast<char>(text[1] | 0x20);
+        int radix = prefix == 'x' ? 16 : prefix == 'o' ? 8 : prefix == 'b' ? 2 : 0;
+        if (radix != 0) {
+            size_t end = 2;
+            double result = 0;
+            for (; end < text.size(); ++end) {
+                char c = text[end];
+                char lower = static_cast<char>(c | 0x20);
+                int digit = isDigit(c) ? c - '0' : (lower >= 'a' && lower <= 'f') ? lower - 'a' + 10 : radix;
+                if (digit >= radix) {
+                    break;
+                }
+                result = result * radix + digit;
+            }
+            if (end == 2) {
+                return 0;
+            }
+            value = result;
+            return end;
+        }
+    }
+
+    size_t end = 0;
+    while (end < text.size() && isDigit(text[end])) {
+        end++;
+    }
+    size_t integerDigits = end;
+    if (!leadingZeros && integerDigits > 1 && text[0] == '0') {
+        return 0;
+    }
+    size_t fractionDigits = 0;
+    if (end < text.size() && text[end] == '.') {
+        size_t start = ++end;
+        while (end < text.size() && isDigit(text[end])) {
+            end++;
+        }
+        fractionDigits = end - start;
+    }
+    if (integerDigits == 0 && fractionDigits == 0) {
+        return 0;
+    }
+    if (end < text.size() && (text[end] == 'e' || text[end] == 'E')) {
+        size_t exponent = end + 1;
+        if (exponent < text.size() && (text[exponent] == '+' || text[exponent] == '-')) {
+            exponent++;
+        }
+        size_t digits = exponent;
+        while (exponent < text.size() && isDigit(text[exponent])) {
+            exponent++;
+        }
+        if (exponent == digits) {
+            return 0;
+        }
+        end = exponent;
+    }
+    value = decimalToDouble(text.substr(0, end));
+    return end;
+}
+
+/**
+ * ToNumber for strings: trimmed decimal (optionally signed) or 0x / 0o /
+ * 0b literal or Infinity, empty string is 0, anything else NaN
+ */
+double parseNumber(std::string_view text) {
+    while (!text.empty() && isWhitespace(text.front())) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && isWhitespace(text.back())) {
+        text.remove_suffix(1);
+    }
+    if (text.empty()) {
+        return 0;
+    }
+    if (text == "Infinity" || text == "+Infinity") {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (text == "-Infinity") {
+        return -std::numeric_limits<double>::infinity();
+    }
+    bool negative = text.front() == '-';
+    if (negative || text.front() == '+') {
+        text.remove_prefix(1);
+        // Radix prefixes don't take a sign
+        if (text.size() > 1 && text[0] == '0' && std::string_view("xXoObB").find(text[1]) != std::string_view::npos) {
+            return kNaN;
+        }
+    }
+    double number = 0;
+    size_t length = scanNumber(text, true, number);
+    if (length == 0 || length != text.size()) {
+        return kNaN;
+    }
+    return negative ? -number : number;
+}
+
+double toNumber(const SignalValue& value) {
+    switch (value.getType()) {
+        case SignalValue::Type::Null:
+            return 0;
+        case SignalValue::Type::Boolean:
+            return value.asBoolean() ? 1 : 0;
+        case SignalValue::Type::Number:
+            return value.asNumber();
+        case SignalValue::Type::String:
+            return parseNumber(value.asString());
+        default:
+            return kNaN;
+    }
+}
+
+void appendString(std::string& out, const SignalValue& value) {
+    switch (value.getType()) {
+        case SignalValue::Type::Undefined:
+            out += "undefined";
+            break;
+        case SignalValue::Type::Null:
+            out += "null";
+            break;
+        case SignalValue::Type::Boolean:
+            out += value.asBoolean() ? "true" : "false";
+            break;
+        case SignalValue::Type::Number:
+            out += formatNumber(value.asNumber());
+            break;
+        case SignalValue::Type::String:
+            out += value.asString();
+            break;
+        case SignalValue::Type::Array: {
+            // Array.prototype.join: null and undefined elements are empty
+            bool first = true;
+            for (const SignalValue& element : value.asArray()) {
+                if (!first) {
+                    out.push_back(',');
+                }
+                first = false;
+                if (element.getType() != SignalValue::Type::Undefined &&
+                    element.getType() != SignalValue::Type::Null) {
+                    appendString(out, element);
+                }
+            }
+            break;
+        }
+        case SignalValue::Type::Object:
+        case SignalValue::Type::Binary:
+            out += "[object Object]";
+            break;
+    }
+}
+
+bool isTruthy(const SignalValue& value) {
+    switch (value.getType()) {
+        case SignalValue::Type::Undefined:
+        case SignalValue::Type::Null:
+            return false;
+        case SignalValue::Type::Boolean:
+            return value.asBoolean();
+        case SignalValue::Type::Number: {
+            double number = value.asNumber();
+            return number != 0 && !std::isnan(number);
+        }
+        case SignalValue::Type::String:
+            return !value.asString().empty();
+        default:
+            return true;
+    }
+}
+
+bool isPrimitive(const SignalValue& value) {
+    SignalValue::Type type = value.getType();
+    return type != SignalValue::Type::String && type != SignalValue::Type::Object &&
+           type != SignalValue::Type::Array && type != SignalValue::Type::Binary;
+}
+
+/**
+ * === with deep comparison for objects and arrays
+ * Numbers use IEEE equality (NaN unequal, +0 equal to -0), unlike
+ * SignalValue::operator== which implements Object.is
+ */
+bool strictEquals(const SignalValue& a, const SignalValue& b) {
+    if (a.getType() == SignalValue::Type::Number && b.getType() == SignalValue::Type::Number) {
+        return a.asNumber() == b.asNumber();
+    }
+    return a == b;
+}
+
+size_t elementSize(SignalValue::BinaryKind kind) {
+    switch (kind) {
+        case SignalValue::BinaryKind::Int16Array:
+        case SignalValue::BinaryKind::Uint16Array:
+            return 2;
+        case SignalValue::BinaryKind::Int32Array:
+        case SignalValue::BinaryKind::Uint32Array:
+        case SignalValue::BinaryKind::Float32Array:
+            return 4;
+        case SignalValue::BinaryKind::Float64Array:
+        case SignalValue::BinaryKind::BigInt64Array:
+        case SignalValue::BinaryKind::BigUint64Array:
+            return 8;
+        default:
+            return 1;
+    }
+}
+
+double lengthOf(const SignalValue& value) {
+    switch (value.getType()) {
+        case SignalValue::Type::String: {
+            // UTF-16 code units: one per UTF-8 sequence, two for 4-byte ones
+            size_t units = 0;
+            for (char c : value.asString()) {
+                auto byte = static_cast<unsigned char>(c);
+                if ((byte & 0xC0) != 0x80) {
+                    units += byte >= 0xF0 ? 2 : 1;
+                }
+            }
+            return static_cast<double>(units);
+        }
+        case SignalValue::Type::Array:
+            return static_cast<double>(value.asArray().size());
+        case SignalValue::Type::Binary: {
+            SignalValue::BinaryView view = value.asBinary();
+            return static_cast<double>(view.size / elementSize(view.kind));
+        }
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Math.min / Math.max step: NaN is sticky and -0 sorts below +0
+ */
+double minOf(double a, double b) {
+    if (std::isnan(a) || std::isnan(b)) {
+        return kNaN;
+    }
+    if (a == b) {
+        return std::signbit(a) ? a : b;
+    }
+    return a < b ? a : b;
+}
+
+double maxOf(double a, double b) {
+    if (std::isnan(a) || std::isnan(b)) {
+        return kNaN;
+    }
+    if (a == b) {
+        return std::signbit(a) ? b : a;
+    }
+    return a > b ? a : b;
+}
+
+// Math.round: halves round towards +Infinity, sign of zero preserved
+double roundHalfUp(double x) {
+    if (!std::isfinite(x)) {
+        return x;
+    }
+    double rounded = std::floor(x);
+    if (x - rounded >= 0.5) {
+        rounded += 1;
+    }
+    return rounded == 0 ? std::copysign(0.0, x) : rounded;
+}
+
+} // namespace
+
+// ============================================================================
+// Compiler
+// ============================================================================
+
+/**
+ * Single-pass recursive descent compiler
+ * Tokens are lexed on demand and bytecode is emitted while parsing; the
+ * compiler tracks stack depth as it emits so evaluate() can size its
+ * stack up front. Precedence, lowest first:
+ *   ?:  ||  &&  == != === !==  < <= > >=  + -  * / %  unary ! -
+ */
+class Expression::Compiler {
+public:
+    Compiler(std::string_view source, Expression& out) : source_(source), out_(out) {}
+
+    void run() {
+        next();
+        parseExpression();
+        if (token_ != Token::End) {
+            fail("Unexpected '" + std::string(text_) + "'");
+        }
+    }
+
+private:
+    enum class Token { End, Number, String, Name, Punct };
+
+    // Bounds recursion so hostile input can't overflow the native stack
+    class NestingGuard {
+    public:
+        explicit NestingGuard(Compiler& compiler) : compiler_(compiler) {
+            if (++compiler_.nesting_ > kMaxDepth) {
+                compiler_.fail("Expression is nested too deeply");
+            }
+        }
+        ~NestingGuard() { compiler_.nesting_--; }
+    private:
+        Compiler& compiler_;
+    };
+
+    std::string_view source_;
+    Expression& out_;
+    size_t pos_ = 0;
+    size_t nesting_ = 0;
+    size_t depth_ = 0;  // Stack depth at the current emit position
+
+    Token token_ = Token::End;
+    size_t tokenStart_ = 0;
+    std::string_view text_;  // Punctuator or name
+    double number_ = 0;
+    std::string string_;
+
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::invalid_argument("Expression error at " + std::to_string(tokenStart_ + 1) +
+                                    ": " + message);
+    }
+
+    // ---- Lexer ----
+
+    void next() {
+        while (pos_ < source_.size() && isWhitespace(source_[pos_])) {
+            pos_++;
+        }
+        tokenStart_ = pos_;
+        if (pos_ == source_.size()) {
+            token_ = Token::End;
+            text_ = "end of expression";
+            return;
+        }
+
+        char c = source_[pos_];
+        if ((c >= '0' && c <= '9') || (c == '.' && pos_ + 1 < source_.size() &&
+                                       source_[pos_ + 1] >= '0' && source_[pos_ + 1] <= '9')) {
+            lexNumber();
+        } else if (c == '\'' || c == '"') {
+            lexString(c);
+        } else if (isNameStart(c)) {
+            size_t end = pos_ + 1;
+            while (end < source_.size() && (isNameStart(source_[end]) ||
+                                            (source_[end] >= '0' && source_[end] <= '9'))) {
+                end++;
+            }
+            token_ = Token::Name;
+            text_ = source_.substr(pos_, end - pos_);
+            pos_ = end;
+        } else {
+            lexPunct();
+        }
+    }
+
+    static bool isNameStart(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '$';
+    }
+
+    // A literal can't run straight into a name or another digit ("1px", "0b12")
+    void lexNumber() {
+        size_t length = scanNumber(source_.substr(pos_), false, number_);
+        if (length == 0 || (pos_ + length < source_.size() &&
+                            (isNameStart(source_[pos_ + length]) || isDigit(source_[pos_ + length])))) {
+            fail("Invalid number");
+        }
+        token_ = Token::Number;
+        text_ = source_.substr(pos_, length);
+        pos_ += length;
+    }
+
+    void lexString(char quote) {
+        string_.clear();
+        pos_++;
+        while (pos_ < source_.size() && source_[pos_] != quote) {
+            char c = source_[pos_++];
+            if (c == '\\' && pos_ < source_.size()) {
+                char escaped = source_[pos_++];
+                switch (escaped) {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case 'r': c = '\r'; break;
+                    default: c = escaped; break;
+                }
+            }
+            string_.push_back(c);
+        }
+        if (pos_ == source_.size()) {
+            fail("Unterminated string");
+        }
+        pos_++;
+        token_ = Token::String;
+        text_ = source_.substr(tokenStart_, pos_ - tokenStart_);
+    }
+
+    void lexPunct() {
+        static constexpr std::string_view kPunctuators[] = {
+            "===", "!==", "==", "!=", "<=", ">=", "&&", "||",
+            "+", "-", "*", "/", "%", "(", ")", ",", "?", ":", "!", "<", ">",
+        };
+        for (std::string_view punct : kPunctuators) {
+            if (source_.substr(pos_, punct.size()) == punct) {
+                token_ = Token::Punct;
+                text_ = punct;
+                pos_ += punct.size();
+                return;
+            }
+        }
+        text_ = source_.substr(pos_, 1);
+        fail("Unexpected '" + std::string(text_) + "'");
+    }
+
+    bool isPunct(std::string_view punct) const {
+        return token_ == Token::Punct && text_ == punct;
+    }
+
+    void expect(std::string_view punct) {
+        if (!isPunct(punct)) {
+            fail("Expected '" + std::string(punct) + "' but found '" + std::string(text_) + "'");
+        }
+        next();
+    }
+
+    // ---- Emitter ----
+
+    // stackEffect: values pushed minus values popped
+    size_t emit(Op op, uint32_t operand, int stackEffect) {
+        out_.code_.push_back({op, operand});
+        depth_ = static_cast<size_t>(static_cast<int>(depth_) + stackEffect);
+        if (depth_ > out_.maxStack_) {
+            out_.maxStack_ = depth_;
+        }
+        return out_.code_.size() - 1;
+    }
+
+    void emitConstant(SignalValue value) {
+        out_.constants_.push_back(std::move(value));
+        emit(Op::Constant, static_cast<uint32_t>(out_.constants_.size() - 1), 1);
+    }
+
+    void patchJump(size_t at) {
+        out_.code_[at].operand = static_cast<uint32_t>(out_.code_.size());
+    }
+
+    uint32_t variableIndex(std::string_view name) {
+        auto& variables = out_.variables_;
+        for (size_t i = 0; i < variables.size(); ++i) {
+            if (variables[i] == name) {
+                return static_cast<uint32_t>(i);
+            }
+        }
+        variables.emplace_back(name);
+        return static_cast<uint32_t>(variables.size() - 1);
+    }
+
+    // ---- Parser ----
+
+    void parseExpression() {
+        NestingGuard guard(*this);
+        parseOr();
+        if (!isPunct("?")) {
+            return;
+        }
+        next();
+        size_t toElse = emit(Op::JumpIfFalse, 0, -1);
+        parseExpression();
+        size_t toEnd = emit(Op::Jump, 0, 0);
+        depth_--;  // Only one branch's value is on the stack at runtime
+        patchJump(toElse);
+        expect(":");
+        parseExpression();
+        patchJump(toEnd);
+    }
+
+    void parseOr() {
+        parseAnd();
+        while (isPunct("||")) {
+            next();
+            size_t jump = emit(Op::OrJump, 0, -1);
+            parseAnd();
+            patchJump(jump);
+        }
+    }
+
+    void parseAnd() {
+        parseEquality();
+        while (isPunct("&&")) {
+            next();
+            size_t jump = emit(Op::AndJump, 0, -1);
+            parseEquality();
+            patchJump(jump);
+        }
+    }
+
+    void parseEquality() {
+        parseComparison();
+        while (true) {
+            Op op;
+            if (isPunct("==") || isPunct("===")) {
+                op = Op::Equal;
+            } else if (isPunct("!=") || isPunct("!==")) {
+                op = Op::NotEqual;
+            } else {
+                return;
+            }
+            next();
+            parseComparison();
+            emit(op, 0, -1);
+        }
+    }
+
+    void parseComparison() {
+        parseAdditive();
+        while (true) {
+            Op op;
+            if (isPunct("<")) {
+                op = Op::Less;
+            } else if (isPunct("<=")) {
+                op = Op::LessEqual;
+            } else if (isPunct(">")) {
+                op = Op::Greater;
+            } else if (isPunct(">=")) {
+                op = Op::GreaterEqual;
+            } else {
+                return;
+            }
+            next();
+            parseAdditive();
+            emit(op, 0, -1);
+        }
+    }
+
+    void parseAdditive() {
+        parseMultiplicative();
+        while (isPunct("+") || isPunct("-")) {
+            Op op = text_ == "+" ? Op::Add : Op::Subtract;
+            next();
+            parseMultiplicative();
+            emit(op, 0, -1);
+        }
+    }
+
+    void parseMultiplicative() {
+        parseUnary();
+        while (isPunct("*") || isPunct("/") || isPunct("%")) {
+            Op op = text_ == "*" ? Op::Multiply : text_ == "/" ? Op::Divide : Op::Remainder;
+            next();
+            parseUnary();
+            emit(op, 0, -1);
+        }
+    }
+
+    void parseUnary() {
+        if (isPunct("!") || isPunct("-")) {
+            NestingGuard guard(*this);
+            Op op = text_ == "!" ? Op::Not : Op::Negate;
+            next();
+            parseUnary();
+            emit(op, 0, 0);
+            return;
+        }
+        parsePrimary();
+    }
+
+    void parsePrimary() {
+        switch (token_) {
+            case Token::Number:
+                emitConstant(SignalValue(number_));
+                next();
+                return;
+            case Token::String:
+                emitConstant(SignalValue(string_));
+                next();
+                return;
+            case Token::Name:
+                parseName();
+                return;
+            case Token::Punct:
+                if (isPunct("(")) {
+                    next();
+                    parseExpression();
+                    expect(")");
+                    return;
+                }
+                break;
+            case Token::End:
+                break;
+        }
+        fail("Unexpected '" + std::string(text_) + "'");
+    }
+
+    void parseName() {
+        std::string_view name = text_;
+        if (name == "true" || name == "false") {
+            emitConstant(SignalValue(name == "true"));
+            next();
+            return;
+        }
+        if (name == "null") {
+            emitConstant(SignalValue::null());
+            next();
+            return;
+        }
+        if (name == "undefined") {
+            emitConstant(SignalValue());
+            next();
+            return;
+        }
+
+        size_t nameStart = tokenStart_;
+        next();
+        if (!isPunct("(")) {
+            emit(Op::Load, variableIndex(name), 1);
+            return;
+        }
+
+        struct Function {
+            std::string_view name;
+            Op op;
+            int arity;  // -1: any number of arguments
+        };
+        static constexpr Function kFunctions[] = {
+            {"min", Op::Min, -1},   {"max", Op::Max, -1},     {"clamp", Op::Clamp, 3},
+            {"len", Op::Length, 1}, {"abs", Op::Abs, 1},      {"floor", Op::Floor, 1},
+            {"ceil", Op::Ceil, 1},  {"round", Op::Round, 1},
+        };
+        const Function* function = nullptr;
+        for (const Function& candidate : kFunctions) {
+            if (candidate.name == name) {
+                function = &candidate;
+            }
+        }
+        if (!function) {
+            tokenStart_ = nameStart;
+            fail("Unknown function '" + std::string(name) + "'");
+        }
+
+        next();
+        int argc = 0;
+        if (!isPunct(")")) {
+            while (true) {
+                parseExpression();
+                argc++;
+                if (!isPunct(",")) {
+                    break;
+                }
+                next();
+            }
+        }
+        expect(")");
+        if (function->arity >= 0 && argc != function->arity) {
+            tokenStart_ = nameStart;
+            fail(std::string(name) + "() takes " + std::to_string(function->arity) +
+                 (function->arity == 1 ? " argument" : " arguments"));
+        }
+        emit(function->op, static_cast<uint32_t>(argc), 1 - argc);
+    }
+};
+
+/**
+ * Compile source text; throws std::invalid_argument on syntax errors
+ */
+Expression Expression::compile(std::string_view source) {
+    Expression expression;
+    Compiler(source, expression).run();
+    return expression;
+}
+
+// ============================================================================
+// Interpreter
+// ============================================================================
+
+/**
+ * Run the bytecode over input values (in variables() order)
+ * Small programs use an on-stack operand stack, so evaluation only
+ * allocates for the values it produces
+ */
+SignalValue Expression::evaluate(const std::vector<SignalValue>& inputs) const {
+    constexpr size_t kInlineStack = 16;
+    SignalValue inlineStack[kInlineStack];
+    std::vector<SignalValue> heapStack;
+    SignalValue* stack = inlineStack;
+    if (maxStack_ > kInlineStack) {
+        heapStack.resize(maxStack_);
+        stack = heapStack.data();
+    }
+    size_t top = 0;
+
+    const Instruction* code = code_.data();
+    const size_t size = code_.size();
+    for (size_t pc = 0; pc < size;) {
+        const Instruction& instruction = code[pc++];
+        switch (instruction.op) {
+            case Op::Constant:
+                stack[top++] = constants_[instruction.operand];
+                break;
+            case Op::Load:
+                stack[top++] = instruction.operand < inputs.size() ? inputs[instruction.operand] : SignalValue();
+                break;
+
+            case Op::Add: {
+                SignalValue& a = stack[top - 2];
+                const SignalValue& b = stack[top - 1];
+                if (a.getType() == SignalValue::Type::Number && b.getType() == SignalValue::Type::Number) {
+                    a = SignalValue(a.asNumber() + b.asNumber());
+                } else if (isPrimitive(a) && isPrimitive(b)) {
+                    a = SignalValue(toNumber(a) + toNumber(b));
+                } else {
+                    std::string text;
+                    appendString(text, a);
+                    appendString(text, b);
+                    a = SignalValue(text);
+                }
+                top--;
+                break;
+            }
+            case Op::Subtract:
+                stack[top - 2] = SignalValue(toNumber(stack[top - 2]) - toNumber(stack[top - 1]));
+                top--;
+                break;
+            case Op::Multiply:
+                stack[top - 2] = SignalValue(toNumber(stack[top - 2]) * toNumber(stack[top - 1]));
+                top--;
+                break;
+            case Op::Divide:
+                stack[top - 2] = SignalValue(toNumber(stack[top - 2]) / toNumber(stack[top - 1]));
+                top--;
+                break;
+            case Op::Remainder:
+                stack[top - 2] = SignalValue(std::fmod(toNumber(stack[top - 2]), toNumber(stack[top - 1])));
+                top--;
+                break;
+            case Op::Negate:
+                stack[top - 1] = SignalValue(-toNumber(stack[top - 1]));
+                break;
+            case Op::Not:
+                stack[top - 1] = SignalValue(!isTruthy(stack[top - 1]));
+                break;
+
+            case Op::Equal:
+            case Op::NotEqual: {
+                bool equal = strictEquals(stack[top - 2], stack[top - 1]);
+                stack[top - 2] = SignalValue(instruction.op == Op::Equal ? equal : !equal);
+                top--;
+                break;
+            }
+            case Op::Less:
+            case Op::LessEqual:
+            case Op::Greater:
+            case Op::GreaterEqual: {
+                const SignalValue& a = stack[top - 2];
+                const SignalValue& b = stack[top - 1];
+                bool result;
+                if (a.getType() == SignalValue::Type::String && b.getType() == SignalValue::Type::String) {
+                    int order = a.asString().compare(b.asString());
+                    result = instruction.op == Op::Less ? order < 0
+                           : instruction.op == Op::LessEqual ? order <= 0
+                           : instruction.op == Op::Greater ? order > 0
+                           : order >= 0;
+                } else {
+                    double x = toNumber(a);
+                    double y = toNumber(b);
+                    result = instruction.op == Op::Less ? x < y
+                           : instruction.op == Op::LessEqual ? x <= y
+                           : instruction.op == Op::Greater ? x > y
+                           : x >= y;
+                }
+                stack[top - 2] = SignalValue(result);
+                top--;
+                break;
+            }
+
+            case Op::Min:
+            case Op::Max: {
+                size_t argc = instruction.operand;
+                bool isMin = instruction.op == Op::Min;
+                double result = isMin ? std::numeric_limits<double>::infinity()
+                                      : -std::numeric_limits<double>::infinity();
+                for (size_t i = top - argc; i < top; ++i) {
+                    double value = toNumber(stack[i]);
+                    result = isMin ? minOf(result, value) : maxOf(result, value);
+                }
+                top -= argc;
+                stack[top++] = SignalValue(result);
+                break;
+            }
+            case Op::Clamp: {
+                double value = toNumber(stack[top - 3]);
+                double low = toNumber(stack[top - 2]);
+                double high = toNumber(stack[top - 1]);
+                top -= 2;
+                stack[top - 1] = SignalValue(minOf(maxOf(value, low), high));
+                break;
+            }
+            case Op::Length:
+                stack[top - 1] = SignalValue(lengthOf(stack[top - 1]));
+                break;
+            case Op::Abs:
+                stack[top - 1] = SignalValue(std::fabs(toNumber(stack[top - 1])));
+                break;
+            case Op::Floor:
+                stack[top - 1] = SignalValue(std::floor(toNumber(stack[top - 1])));
+                break;
+            case Op::Ceil:
+                stack[top - 1] = SignalValue(std::ceil(toNumber(stack[top - 1])));
+                break;
+            case Op::Round:
+                stack[top - 1] = SignalValue(roundHalfUp(toNumber(stack[top - 1])));
+                break;
+
+            case Op::Jump:
+                pc = instruction.operand;
+                break;
+            case Op::JumpIfFalse:
+                if (!isTruthy(stack[--top])) {
+                    pc = instruction.operand;
+                }
+                break;
+            case Op::AndJump:
+                if (!isTruthy(stack[top - 1])) {
+                    pc = instruction.operand;
+                } else {
+                    top--;
+                }
+                break;
+            case Op::OrJump:
+                if (isTruthy(stack[top - 1])) {
+                    pc = instruction.operand;
+                } else {
+                    top--;
+                }
+                break;
+        }
+    }
+    return top > 0 ? stack[top - 1] : SignalValue();
+}
+
+} // namespace signalforge
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "signalStore.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace signalforge {
+
+/**
+ * Expression - compiled formula for native computed signals
+ *
+ * A small JS-flavoured expression language compiled once to bytecode for
+ * a stack machine, so recomputing a computed signal is a tight loop over
+ * SignalValues with no JS call and no parsing:
+ *
+ *   total   = "price * qty"
+ *   isValid = "len(name) > 0 && age >= 18"
+ *   label   = "count == 1 ? '1 item' : count + ' items'"
+ *
+ * Supported:
+ * - Literals: numbers, 'strings' / "strings", true, false, null, undefined
+ * - Variables: identifiers, bound to input signals by name
+ * - Arithmetic: + - * / % and unary -; + concatenates when either side is
+ *   a string (or object/array, like JS)
+ * - Comparison: < <= > >= (strings compare lexicographically), == != (and
+ *   === !==, which mean the same: strict, deep for objects and arrays)
+ * - Logic: && || (short-circuit, return an operand like JS), !, a ? b : c
+ * - Functions: min(...), max(...), clamp(x, lo, hi), abs(x), floor(x),
+ *   ceil(x), round(x) (Math semantics), and len(x): string length in
+ *   UTF-16 units, array or typed array length, 0 for anything else
+ *
+ * Conversions follow JS (ToNumber, ToString, truthiness), so evaluation
+ * never throws: bad input yields NaN, like the JS expression would.
+ * Syntax errors throw std::invalid_argument from compile()
+ */
+class Expression {
+public:
+    // Deepest parenthesis/operator nesting accepted (bounds compile recursion)
+    static constexpr size_t kMaxDepth = 128;
+
+    static Expression compile(std::string_view source);
+
+    // Variable names in first-use order; evaluate() takes their values in
+    // this order
+    const std::vector<std::string>& variables() const { return variables_; }
+
+    SignalValue evaluate(const std::vector<SignalValue>& inputs) const;
+
+private:
+    enum class Op : uint8_t {
+        Constant,      // push constants_[operand]
+        Load,          // push inputs[operand]
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Remainder,
+        Negate,
+        Not,
+        Equal,
+        NotEqual,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Min,           // operand = argument count
+        Max,           // operand = argument count
+        Clamp,
+        Length,
+        Abs,
+        Floor,
+        Ceil,
+        Round,
+        Jump,          // pc = operand
+        JumpIfFalse,   // pop; pc = operand if falsy
+        AndJump,       // falsy top: keep it and jump; else pop
+        OrJump,        // truthy top: keep it and jump; else pop
+    };
+
+    struct Instruction {
+        Op op;
+        uint32_t operand;
+    };
+
+    class Compiler;
+
+    std::vector<Instruction> code_;
+    std::vector<SignalValue> constants_;
+    std::vector<std::string> variables_;
+    size_t maxStack_ = 0;
+};
+
+} // namespace signalforge
@@ -8,7 +8,7 @@
 
 // Export the main JSI bridge (primary API)
 export { default as jsiBridge } from './jsiBridge';
-export type { SignalRef } from './jsiBridge';
+export type { SignalRef, NativeSignalObject } from './jsiBridge';
 
 // Export setup and diagnostic utilities
 export {
@@ -30,11 +30,22 @@ import jsiBridge from './jsiBridge';
 
 export const {
   createSignal,
+  createNumericSignal,
+  createComputedExpression,
   getSignal,
+  getMany,
+  getManyInto,
   setSignal,
+  addNumber,
+  incrementNumber,
+  minNumber,
+  maxNumber,
+  compareAndSet,
   hasSignal,
   deleteSignal,
   getSignalVersion,
+  createVersionReader,
+  subscribe,
   batchUpdate,
   isUsingNative,
   getImplementationInfo,
@@ -36,7 +36,7 @@ RCT_EXPORT_BLOCKING_SYNCHRONOUS_METHOD(install)
 
   try {
     auto runtime = (jsi::Runtime *)cxxBridge.runtime;
-    signalforge::installJSIBindings(*runtime);
+    signalforge::installJSIBindings(*runtime, bridge.jsCallInvoker);
     return @YES;
   } catch (const std::exception &e) {
     RCTLogError(@"[SignalForge] Failed to install JSI bindings: %s", e.what());
@@ -17,7 +17,7 @@
  * - Falls back on Web/Node.js environments
  */
 
-import { createSignal as createJsSignal, type Signal } from '../core/store';
+import { batch, createSignal as createJsSignal, type Signal } from '../core/store';
 
 // ============================================================================
 // Type Definitions
@@ -26,9 +26,31 @@ import { createSignal as createJsSignal, type Signal } from '../core/store';
 /**
  * Signal reference returned by create operations
  * Contains the unique identifier used for all subsequent operations
+ * 
+ * `handle` is the native slot/generation handle when the native store is
+ * active. Native calls pass it instead of `id`, so lookups index the slot
+ * table directly without string conversion or hashing
  */
 export interface SignalRef {
   id: string;
+  handle?: number;
+  object?: NativeSignalObject;
+  // Numeric signals: index of the value in the shared Float64 buffer
+  cell?: number;
+}
+
+/**
+ * Native host object bound to a single C++ Signal
+ * Property access goes straight to the Signal: no store lock, no ID lookup.
+ * subscribe delivers like __signalForgeSubscribe and throws when the
+ * bindings were installed without a CallInvoker
+ */
+export interface NativeSignalObject {
+  value: any;
+  readonly version: number;
+  readonly handle: number;
+  readonly id: string;
+  subscribe(callback: (value: any) => void): () => void;
 }
 
 /**
@@ -42,12 +64,32 @@ declare const HermesInternal: any | undefined;
  */
 declare global {
   var __signalForgeCreateSignal: ((initialValue: any) => string) | undefined;
-  var __signalForgeGetSignal: ((signalId: string) => any) | undefined;
-  var __signalForgeSetSignal: ((signalId: string, value: any) => void) | undefined;
-  var __signalForgeHasSignal: ((signalId: string) => boolean) | undefined;
-  var __signalForgeDeleteSignal: ((signalId: string) => void) | undefined;
-  var __signalForgeGetVersion: ((signalId: string) => number) | undefined;
-  var __signalForgeBatchUpdate: ((updates: [string, any][]) => void) | undefined;
+  var __signalForgeCreateHandle: ((initialValue: any) => number) | undefined;
+  var __signalForgeGetSignal: ((signalId: string | number) => any) | undefined;
+  var __signalForgeGetMany: ((signalIds: (string | number)[]) => any[]) | undefined;
+  var __signalForgeGetManyInto: ((signalIds: (string | number)[], target: any[]) => number) | undefined;
+  var __signalForgeSetSignal: ((signalId: string | number, value: any) => void) | undefined;
+  var __signalForgeHasSignal: ((signalId: string | number) => boolean) | undefined;
+  var __signalForgeDeleteSignal: ((signalId: string | number) => void) | undefined;
+  var __signalForgeGetVersion: ((signalId: string | number) => number) | undefined;
+  var __signalForgeGetVersionBuffer: ((chunkIndex: number) => Uint32Array | undefined) | undefined;
+  var __signalForgeVersionChunkShift: number | undefined;
+  var __signalForgeCreateNumericSignal: ((initialValue: number) => { handle: number; id: string; cell: number }) | undefined;
+  var __signalForgeSetNumber: ((signalId: string | number, value: number) => void) | undefined;
+  var __signalForgeAdd: ((signalId: string | number, delta: number) => number) | undefined;
+  var __signalForgeIncrement: ((signalId: string | number) => number) | undefined;
+  var __signalForgeMin: ((signalId: string | number, value: number) => number) | undefined;
+  var __signalForgeMax: ((signalId: string | number, value: number) => number) | undefined;
+  var __signalForgeCompareAndSet: ((signalId: string | number, expectedVersion: number, value: any) => boolean) | undefined;
+  var __signalForgeGetNumericBuffer: ((chunkIndex: number) => Float64Array | undefined) | undefined;
+  var __signalForgeNumericChunkShift: number | undefined;
+  var __signalForgeCreateComputed: ((expression: string, inputs: Record<string, string | number>) => number) | undefined;
+  var __signalForgeSubscribe: ((signalId: string | number, callback: (value: any) => void) => number) | undefined;
+  var __signalForgeUnsubscribe: ((subscriptionId: number) => boolean) | undefined;
+  var __signalForgeBatchUpdate: ((updates: [string | number, any][]) => void) | undefined;
+  var __signalForgeCreateSignalObject: ((initialValue: any) => NativeSignalObject) | undefined;
+  var __signalForgeGetSignalObject: ((signalId: string | number) => NativeSignalObject) | undefined;
+  var __signalForgeGetPoolStats: (() => Record<string, number>) | undefined;
 }
 
 // ============================================================================
@@ -96,6 +138,81 @@ try {
 
 const NATIVE_READY = isNativeAvailable();
 
+/**
+ * Numeric handles are available on native builds that install
+ * __signalForgeCreateHandle; older native builds only issue string IDs
+ */
+const HANDLES_READY =
+  NATIVE_READY && typeof global.__signalForgeCreateHandle === 'function';
+
+/**
+ * Signal host objects are available on native builds that install
+ * __signalForgeCreateSignalObject; hot reads and writes then bypass the
+ * __signalForge* globals entirely
+ */
+const OBJECTS_READY =
+  HANDLES_READY && typeof global.__signalForgeCreateSignalObject === 'function';
+
+/**
+ * Numeric signals are available on native builds that install
+ * __signalForgeCreateNumericSignal
+ */
+const NUMERIC_READY =
+  HANDLES_READY &&
+  typeof global.__signalForgeCreateNumericSignal === 'function' &&
+  typeof global.__signalForgeGetNumericBuffer === 'function' &&
+  typeof global.__signalForgeNumericChunkShift === 'number';
+
+/**
+ * Native computed expressions are available on native builds that install
+ * __signalForgeCreateComputed
+ */
+const COMPUTED_READY =
+  HANDLES_READY && typeof global.__signalForgeCreateComputed === 'function';
+
+/**
+ * Atomic numeric updates and versioned writes are available on native
+ * builds that install __signalForgeAdd and friends
+ */
+const ATOMIC_UPDATES_READY =
+  NATIVE_READY &&
+  typeof global.__signalForgeAdd === 'function' &&
+  typeof global.__signalForgeIncrement === 'function' &&
+  typeof global.__signalForgeMin === 'function' &&
+  typeof global.__signalForgeMax === 'function' &&
+  typeof global.__signalForgeCompareAndSet === 'function';
+
+/**
+ * Native subscriptions are available when the bindings were installed
+ * with a CallInvoker; they also deliver writes made on native threads
+ */
+const SUBSCRIBE_READY =
+  NATIVE_READY &&
+  typeof global.__signalForgeSubscribe === 'function' &&
+  typeof global.__signalForgeUnsubscribe === 'function';
+
+// Live Float64Array views over native numeric chunks, fetched once each
+const numericChunks: (Float64Array | undefined)[] = [];
+
+/**
+ * Float64Array chunk holding a numeric cell, fetched on first use
+ */
+const numericChunkFor = (cell: number): Float64Array => {
+  const chunkIndex = cell >>> global.__signalForgeNumericChunkShift!;
+  let chunk = numericChunks[chunkIndex];
+  if (!chunk) {
+    chunk = global.__signalForgeGetNumericBuffer!(chunkIndex)!;
+    numericChunks[chunkIndex] = chunk;
+  }
+  return chunk;
+};
+
+/**
+ * Native argument for a signal: its handle when known, otherwise its ID
+ */
+const nativeKey = (signalRef: SignalRef): string | number =>
+  signalRef.handle ?? signalRef.id;
+
 // ============================================================================
 // Fallback JavaScript Store
 // ============================================================================
@@ -115,6 +232,7 @@ interface FallbackStore {
   hasSignal(id: string): boolean;
   deleteSignal(id: string): void;
   getSignalVersion(id: string): number;
+  subscribe<T>(id: string, listener: (value: T) => void): () => void;
 }
 
 let jsStore: FallbackStore | null = null;
@@ -165,6 +283,13 @@ const getJsStore = (): FallbackStore => {
       getSignalVersion(id: string): number {
         return signals.get(id)?.version ?? 0;
       },
+      subscribe<T>(id: string, listener: (value: T) => void): () => void {
+        const entry = signals.get(id);
+        if (!entry) {
+          throw new Error(`Signal "${id}" does not exist`);
+        }
+        return entry.signal.subscribe(listener);
+      },
     };
   }
   return jsStore;
@@ -181,16 +306,35 @@ const getJsStore = (): FallbackStore => {
  * - Calls C++ JSI function directly via global.__signalForgeCreateSignal
  * - Value is converted from JS to C++ SignalValue in native code
  * - Signal is stored in C++ memory (shared_ptr managed)
- * - Returns unique signal ID generated by C++ atomic counter
+ * - Returns a numeric slot/generation handle plus its string ID form
  * 
  * Fallback path:
  * - Uses pure JavaScript Store implementation
  * - Signal stored in JavaScript heap
  * 
- * @param initialValue - The initial value for the signal (any JSON-serializable type)
+ * Native values: primitives, plain objects/arrays (stored as native trees)
+ * and ArrayBuffer/TypedArray payloads. Binary values are copied into native
+ * memory once; reads return a view onto that shared memory without a copy.
+ * Treat it as read-only and publish changes by setting a new buffer: binary
+ * values compare by identity, so in-place writes never notify
+ * 
+ * @param initialValue - The initial value for the signal (any JSON-serializable type or binary data)
  * @returns SignalRef containing unique signal ID
  */
 export const createSignal = <T = any>(initialValue: T): SignalRef => {
+  if (OBJECTS_READY) {
+    // Host object bound to the C++ Signal for direct hot-path access
+    const object = global.__signalForgeCreateSignalObject!(initialValue);
+    const handle = object.handle;
+    return { id: `sig_${handle}`, handle, object };
+  }
+  
+  if (HANDLES_READY) {
+    // Numeric handle; the string ID is its textual form ("sig_<handle>")
+    const handle = global.__signalForgeCreateHandle!(initialValue);
+    return { id: `sig_${handle}`, handle };
+  }
+  
   if (NATIVE_READY) {
     // Direct JSI call - no overhead, direct C++ execution
     const id = global.__signalForgeCreateSignal!(initialValue);
@@ -204,12 +348,78 @@ export const createSignal = <T = any>(initialValue: T): SignalRef => {
   return { id: (signal as any).__id || String(Math.random()) };
 };
 
+/**
+ * Create a number-only signal
+ * 
+ * Native path:
+ * - The value also lives in a shared native Float64 buffer
+ * - getSignal is a plain Float64Array load: no host call, no conversion
+ * - setSignal uses a number-only host call that bumps the version and
+ *   notifies subscribers like any other write
+ * - Writing a non-number throws
+ * 
+ * Fallback: a regular signal
+ * 
+ * @param initialValue - Initial number
+ * @returns SignalRef for use with the regular bridge functions
+ */
+export const createNumericSignal = (initialValue: number): SignalRef => {
+  if (NUMERIC_READY) {
+    const { handle, id, cell } = global.__signalForgeCreateNumericSignal!(initialValue);
+    return { id, handle, cell };
+  }
+  
+  return createSignal(initialValue);
+};
+
+/**
+ * Create a read-only signal computed natively from an expression
+ * 
+ * The expression is compiled to bytecode once and re-evaluated in C++
+ * whenever an input changes (lazily on read, or eagerly while the signal
+ * has native subscribers), so derived values never wait on the JS thread.
+ * Results that compare equal don't bump the version.
+ * 
+ * Expressions cover literals, + - * / %, comparisons, && || ! and ?:,
+ * string concatenation with +, and min, max, clamp, len, abs, floor,
+ * ceil and round, with JS conversion rules. Identifiers name the inputs:
+ * 
+ * ```typescript
+ * const total = createComputedExpression('price * qty', { price, qty });
+ * const isValid = createComputedExpression('len(name) > 0 && age >= 18', { name, age });
+ * ```
+ * 
+ * Requires the native store: the JS fallback has no expression engine
+ * (check getImplementationInfo().features.computedExpressions, or use
+ * createComputed from the core store).
+ * 
+ * @param expression - Expression source
+ * @param inputs - Signal for each identifier used in the expression
+ * @returns SignalRef for reads; setSignal on it throws
+ * @throws Error on syntax errors, unbound identifiers or without native support
+ */
+export const createComputedExpression = (
+  expression: string,
+  inputs: Record<string, SignalRef>
+): SignalRef => {
+  if (!COMPUTED_READY) {
+    throw new Error('createComputedExpression requires the SignalForge native module');
+  }
+  
+  const nativeInputs: Record<string, string | number> = {};
+  for (const name of Object.keys(inputs)) {
+    nativeInputs[name] = nativeKey(inputs[name]);
+  }
+  const handle = global.__signalForgeCreateComputed!(expression, nativeInputs);
+  return { id: `sig_${handle}`, handle };
+};
+
 /**
  * Get the current value of a signal
  * 
  * Native path:
  * - Calls C++ JSI function with signal ID
- * - C++ looks up signal in thread-safe unordered_map
+ * - C++ indexes the slot table with the signal's handle
  * - Acquires mutex, reads value, releases mutex
  * - Converts C++ SignalValue to JS value via toJSI()
  * 
@@ -221,9 +431,18 @@ export const createSignal = <T = any>(initialValue: T): SignalRef => {
  * @throws Error if signal doesn't exist
  */
 export const getSignal = <T = any>(signalRef: SignalRef): T => {
+  if (signalRef.cell !== undefined) {
+    const chunk = numericChunkFor(signalRef.cell);
+    return chunk[signalRef.cell & (chunk.length - 1)] as T;
+  }
+  
+  if (signalRef.object) {
+    return signalRef.object.value as T;
+  }
+  
   if (NATIVE_READY) {
     // Direct C++ memory access - returns value immediately
-    return global.__signalForgeGetSignal!(signalRef.id) as T;
+    return global.__signalForgeGetSignal!(nativeKey(signalRef)) as T;
   }
   
   // Fallback: retrieve from JS Store
@@ -231,6 +450,59 @@ export const getSignal = <T = any>(signalRef: SignalRef): T => {
   return store.getSignal<T>(signalRef.id);
 };
 
+/**
+ * Bulk reads are available on native builds that install __signalForgeGetMany
+ */
+const GET_MANY_READY =
+  NATIVE_READY &&
+  typeof global.__signalForgeGetMany === 'function' &&
+  typeof global.__signalForgeGetManyInto === 'function';
+
+/**
+ * Read many signals at once
+ * 
+ * Native path: one JSI call for the whole list instead of one per signal;
+ * C++ locks each store shard once and converts every value in that call.
+ * Deleted signals read as undefined.
+ * 
+ * @param signalRefs - Signals to read
+ * @returns Values in the same order as signalRefs
+ */
+export const getMany = (signalRefs: SignalRef[]): any[] => {
+  if (GET_MANY_READY) {
+    return global.__signalForgeGetMany!(signalRefs.map(nativeKey));
+  }
+  
+  return signalRefs.map((signalRef) => readOrUndefined(signalRef));
+};
+
+/**
+ * Read many signals into a caller-owned array
+ * 
+ * Same as getMany, but reuses `target` (e.g. one array per list, kept
+ * across renders) instead of allocating a result array per call.
+ * 
+ * @param signalRefs - Signals to read
+ * @param target - Array receiving values at indices 0..signalRefs.length-1
+ * @returns Number of values written
+ */
+export const getManyInto = (signalRefs: SignalRef[], target: any[]): number => {
+  if (GET_MANY_READY) {
+    return global.__signalForgeGetManyInto!(signalRefs.map(nativeKey), target);
+  }
+  
+  for (let i = 0; i < signalRefs.length; i++) {
+    target[i] = readOrUndefined(signalRefs[i]);
+  }
+  return signalRefs.length;
+};
+
+/**
+ * Single read with the bulk APIs' semantics: undefined for deleted signals
+ */
+const readOrUndefined = (signalRef: SignalRef): any =>
+  hasSignal(signalRef) ? getSignal(signalRef) : undefined;
+
 /**
  * Update a signal's value
  * 
@@ -240,6 +512,9 @@ export const getSignal = <T = any>(signalRef: SignalRef): T => {
  * - Looks up signal in store (mutex protected)
  * - Calls signal->setValue() which:
  *   * Acquires signal's mutex
+ *   * Returns early when the value is unchanged (Object.is for numbers,
+ *     deep equality for strings, objects and arrays, identity for
+ *     binary data)
  *   * Updates the value
  *   * Atomically increments version counter (lock-free)
  *   * Releases mutex
@@ -256,9 +531,19 @@ export const getSignal = <T = any>(signalRef: SignalRef): T => {
  * @throws Error if signal doesn't exist
  */
 export const setSignal = <T = any>(signalRef: SignalRef, value: T): void => {
+  if (signalRef.cell !== undefined) {
+    global.__signalForgeSetNumber!(nativeKey(signalRef), value as unknown as number);
+    return;
+  }
+  
+  if (signalRef.object) {
+    signalRef.object.value = value;
+    return;
+  }
+  
   if (NATIVE_READY) {
     // Direct C++ call - updates C++ memory and triggers atomic version bump
-    global.__signalForgeSetSignal!(signalRef.id, value);
+    global.__signalForgeSetSignal!(nativeKey(signalRef), value);
     return;
   }
   
@@ -267,11 +552,102 @@ export const setSignal = <T = any>(signalRef: SignalRef, value: T): void => {
   store.setSignal(signalRef.id, value);
 };
 
+/**
+ * Read-modify-write fallback: JS-side get + set (not atomic against native
+ * writers, which only exist when the native store is active)
+ */
+const updateNumberInJs = (
+  signalRef: SignalRef,
+  update: (current: number) => number
+): number => {
+  const next = update(getSignal<number>(signalRef));
+  setSignal(signalRef, next);
+  return next;
+};
+
+/**
+ * Add to a signal holding a number atomically
+ * 
+ * Native path (any signal whose current value is a number; others throw):
+ * - One host call reads, adds and commits under the signal's writer lock,
+ *   so concurrent native writers can't interleave and lose updates
+ * - One version bump and notification (none if delta is 0)
+ * 
+ * Fallback: get + set (no native writers to race with)
+ * 
+ * @param signalRef - Reference to a signal holding a number
+ * @param delta - Amount to add
+ * @returns The resulting value
+ */
+export const addNumber = (signalRef: SignalRef, delta: number): number => {
+  if (ATOMIC_UPDATES_READY) {
+    return global.__signalForgeAdd!(nativeKey(signalRef), delta);
+  }
+  return updateNumberInJs(signalRef, (current) => current + delta);
+};
+
+/**
+ * Add 1 to a numeric signal atomically (see addNumber)
+ * Suited to unread badges, retry counters and the like
+ */
+export const incrementNumber = (signalRef: SignalRef): number => {
+  if (ATOMIC_UPDATES_READY) {
+    return global.__signalForgeIncrement!(nativeKey(signalRef));
+  }
+  return updateNumberInJs(signalRef, (current) => current + 1);
+};
+
+/**
+ * Lower a numeric signal to value if value is smaller (Math.min), atomically
+ * Unchanged results don't bump the version
+ */
+export const minNumber = (signalRef: SignalRef, value: number): number => {
+  if (ATOMIC_UPDATES_READY) {
+    return global.__signalForgeMin!(nativeKey(signalRef), value);
+  }
+  return updateNumberInJs(signalRef, (current) => Math.min(current, value));
+};
+
+/**
+ * Raise a numeric signal to value if value is larger (Math.max), atomically
+ * Keeps download progress monotonic when chunks report out of order
+ */
+export const maxNumber = (signalRef: SignalRef, value: number): number => {
+  if (ATOMIC_UPDATES_READY) {
+    return global.__signalForgeMax!(nativeKey(signalRef), value);
+  }
+  return updateNumberInJs(signalRef, (current) => Math.max(current, value));
+};
+
+/**
+ * Write a value only if nothing else wrote the signal since expectedVersion
+ * (from getSignalVersion)
+ * 
+ * Native path: version check and write happen under the signal's writer
+ * lock in one host call. Works on any writable signal
+ * 
+ * @returns true if written, false if the version had moved on
+ */
+export const compareAndSet = <T = any>(
+  signalRef: SignalRef,
+  expectedVersion: number,
+  value: T
+): boolean => {
+  if (ATOMIC_UPDATES_READY) {
+    return global.__signalForgeCompareAndSet!(nativeKey(signalRef), expectedVersion, value);
+  }
+  if (getSignalVersion(signalRef) !== expectedVersion) {
+    return false;
+  }
+  setSignal(signalRef, value);
+  return true;
+};
+
 /**
  * Check if a signal exists in the store
  * 
  * Native path:
- * - Quick hash table lookup in C++ unordered_map
+ * - Slot table lookup in C++ (handle index + generation check)
  * - Returns boolean immediately
  * 
  * @param signalRef - Reference to the signal
@@ -279,7 +655,7 @@ export const setSignal = <T = any>(signalRef: SignalRef, value: T): void => {
  */
 export const hasSignal = (signalRef: SignalRef): boolean => {
   if (NATIVE_READY) {
-    return global.__signalForgeHasSignal!(signalRef.id);
+    return global.__signalForgeHasSignal!(nativeKey(signalRef));
   }
   
   const store = getJsStore();
@@ -290,7 +666,7 @@ export const hasSignal = (signalRef: SignalRef): boolean => {
  * Delete a signal from the store
  * 
  * Native path:
- * - Removes signal from C++ unordered_map
+ * - Frees the signal's slot and bumps its generation (stale handles miss)
  * - shared_ptr reference count decrements
  * - If no other references exist, Signal is automatically destroyed
  * - C++ destructor handles cleanup (mutex, version counter, subscribers)
@@ -301,7 +677,11 @@ export const hasSignal = (signalRef: SignalRef): boolean => {
  */
 export const deleteSignal = (signalRef: SignalRef): void => {
   if (NATIVE_READY) {
-    global.__signalForgeDeleteSignal!(signalRef.id);
+    global.__signalForgeDeleteSignal!(nativeKey(signalRef));
+    // A deleted signal's host object is detached; route later calls
+    // through the store so they report the missing signal
+    signalRef.object = undefined;
+    signalRef.cell = undefined;
     return;
   }
   
@@ -333,15 +713,104 @@ export const deleteSignal = (signalRef: SignalRef): void => {
  * @returns Current version number (increments on each update)
  */
 export const getSignalVersion = (signalRef: SignalRef): number => {
+  if (signalRef.object) {
+    return signalRef.object.version;
+  }
+  
   if (NATIVE_READY) {
     // Lock-free atomic read for low-overhead change detection.
-    return global.__signalForgeGetVersion!(signalRef.id);
+    return global.__signalForgeGetVersion!(nativeKey(signalRef));
   }
   
   const store = getJsStore();
   return store.getSignalVersion(signalRef.id);
 };
 
+/**
+ * Shared version buffer is available on native builds that install
+ * __signalForgeGetVersionBuffer (requires numeric handles)
+ */
+const VERSION_BUFFER_READY =
+  HANDLES_READY &&
+  typeof global.__signalForgeGetVersionBuffer === 'function' &&
+  typeof global.__signalForgeVersionChunkShift === 'number';
+
+// Live Uint32Array views over native version chunks, fetched once each
+const versionChunks: (Uint32Array | undefined)[] = [];
+
+/**
+ * Create a cheap change-detection reader for a signal
+ * 
+ * Native path (shared version buffer):
+ * - Resolves the signal's slot in the native version buffer once
+ * - Each call is a plain typed-array read: no JSI host call at all
+ * - The counter advances on every change (and when the signal is
+ *   deleted), so compare readings for equality only
+ * 
+ * Ideal as a useSyncExternalStore getSnapshot companion: poll the reader
+ * every render and only call getSignal when the reading changes.
+ * 
+ * Fallback: reads getSignalVersion on every call
+ * 
+ * @param signalRef - Signal to watch
+ * @returns Function returning the signal's current change counter
+ */
+export const createVersionReader = (signalRef: SignalRef): (() => number) => {
+  if (VERSION_BUFFER_READY && signalRef.handle !== undefined) {
+    const shift = global.__signalForgeVersionChunkShift!;
+    const slot = signalRef.handle % 0x100000000;
+    const chunkIndex = slot >>> shift;
+    const index = slot & ((1 << shift) - 1);
+    
+    let versions = versionChunks[chunkIndex];
+    if (!versions) {
+      versions = global.__signalForgeGetVersionBuffer!(chunkIndex);
+      versionChunks[chunkIndex] = versions;
+    }
+    if (versions) {
+      const chunk = versions;
+      return () => chunk[index];
+    }
+  }
+  
+  return () => getSignalVersion(signalRef);
+};
+
+/**
+ * Subscribe to changes of a signal
+ * 
+ * Native path (__signalForgeSubscribe):
+ * - Writes from any thread are delivered, including native producers
+ * - Changes are queued natively and delivered on the JS thread in one
+ *   CallInvoker task per tick, so bursts cost one crossing
+ * - Each listener gets only the latest value since the previous tick
+ * - Delivery is asynchronous: the listener runs after the write returns
+ * 
+ * Native signals cannot be watched without native subscriptions; the
+ * fallback store subscribes to the JS signal.
+ * 
+ * @param signalRef - Signal to watch
+ * @param listener - Called with the new value
+ * @returns Function that stops delivery (pending changes are dropped)
+ */
+export const subscribe = <T = any>(
+  signalRef: SignalRef,
+  listener: (value: T) => void
+): (() => void) => {
+  if (SUBSCRIBE_READY) {
+    const subscriptionId = global.__signalForgeSubscribe!(nativeKey(signalRef), listener);
+    return () => {
+      global.__signalForgeUnsubscribe!(subscriptionId);
+    };
+  }
+  
+  if (NATIVE_READY) {
+    throw new Error('subscribe requires native subscriptions (bindings installed with a CallInvoker)');
+  }
+  
+  return getJsStore().subscribe(signalRef.id, listener);
+};
+
 /**
  * Batch update multiple signals in one operation
  * 
@@ -352,28 +821,31 @@ export const getSignalVersion = (signalRef: SignalRef): number => {
  * 
  * Native path:
  * - Single JSI call passes entire array to C++
- * - C++ validates all signals exist before updating any
- * - Updates all signals in sequence
- * - Each signal's version still increments individually
- * - Subscribers notified after all updates complete
+ * - Unknown signals are skipped
+ * - Repeated writes to one signal collapse to the last value
+ * - All writes are applied before any subscriber runs, so subscribers
+ *   never observe a half-applied batch
+ * - Each changed signal bumps its version once and notifies once
  * 
  * @param updates - Array of [signalRef, value] tuples
  */
 export const batchUpdate = (updates: [SignalRef, any][]): void => {
   if (NATIVE_READY) {
-    // Convert SignalRef[] to string[] for C++ consumption
-    const nativeUpdates: [string, any][] = updates.map(([ref, value]) => [
-      ref.id,
+    // Convert SignalRef[] to handles/IDs for C++ consumption
+    const nativeUpdates: [string | number, any][] = updates.map(([ref, value]) => [
+      nativeKey(ref),
       value,
     ]);
     global.__signalForgeBatchUpdate!(nativeUpdates);
     return;
   }
   
-  // Fallback: update each signal individually
-  for (const [ref, value] of updates) {
-    setSignal(ref, value);
-  }
+  // Fallback: update each signal inside a JS batch
+  batch(() => {
+    for (const [ref, value] of updates) {
+      setSignal(ref, value);
+    }
+  });
 };
 
 /**
@@ -406,6 +878,14 @@ export const getImplementationInfo = () => {
       atomicOperations: NATIVE_READY,
       threadSafe: NATIVE_READY,
       sharedPtrManagement: NATIVE_READY,
+      numericHandles: HANDLES_READY,
+      signalObjects: OBJECTS_READY,
+      bulkReads: GET_MANY_READY,
+      versionBuffer: VERSION_BUFFER_READY,
+      numericBuffer: NUMERIC_READY,
+      computedExpressions: COMPUTED_READY,
+      nativeSubscriptions: SUBSCRIBE_READY,
+      atomicNumericUpdates: ATOMIC_UPDATES_READY,
     },
   };
 };
@@ -416,11 +896,22 @@ export const getImplementationInfo = () => {
 
 export default {
   createSignal,
+  createNumericSignal,
+  createComputedExpression,
   getSignal,
+  getMany,
+  getManyInto,
   setSignal,
+  addNumber,
+  incrementNumber,
+  minNumber,
+  maxNumber,
+  compareAndSet,
   hasSignal,
   deleteSignal,
   getSignalVersion,
+  createVersionReader,
+  subscribe,
   batchUpdate,
   isUsingNative,
   getImplementationInfo,
@@ -1,352 +1,452 @@
 #include "jsiStore.h"
-#include <sstream>
-#include <iomanip>
-#include <random>
-#include <chrono>
+#include "coalescedNotifier.h"
+#include "expression.h"
+#include <cmath>
+#include <stdexcept>
 
 namespace signalforge {
 
 // ============================================================================
-// SignalValue Implementation
+// JSI Value Conversion
 // ============================================================================
 
-/**
- * Default constructor - creates an undefined value
- */
-SignalValue::SignalValue() 
-    : type_(Type::Undefined), boolValue_(false), numberValue_(0.0) {}
+namespace {
+
+// JS constructor names indexed by SignalValue::BinaryKind
+constexpr const char* kBinaryKindNames[] = {
+    "ArrayBuffer",
+    "Int8Array",
+    "Uint8Array",
+    "Uint8ClampedArray",
+    "Int16Array",
+    "Uint16Array",
+    "Int32Array",
+    "Uint32Array",
+    "Float32Array",
+    "Float64Array",
+    "BigInt64Array",
+    "BigUint64Array",
+};
 
 /**
- * Boolean constructor - stores primitive boolean value
+ * Resolve a TypedArray constructor name; unknown views (e.g. DataView)
+ * come back to JS as a plain ArrayBuffer
  */
-SignalValue::SignalValue(bool value)
-    : type_(Type::Boolean), boolValue_(value), numberValue_(0.0) {}
+SignalValue::BinaryKind binaryKindFromName(const std::string& name) {
+    for (size_t i = 1; i < sizeof(kBinaryKindNames) / sizeof(kBinaryKindNames[0]); i++) {
+        if (name == kBinaryKindNames[i]) {
+            return static_cast<SignalValue::BinaryKind>(i);
+        }
+    }
+    return SignalValue::BinaryKind::ArrayBuffer;
+}
 
 /**
- * Number constructor - stores primitive numeric value
+ * BinaryBuffer - jsi::MutableBuffer over a Binary SignalValue's memory
+ * Holding a SignalValue copy keeps the native bytes alive for as long as
+ * the JS ArrayBuffer exists. The memory is shared with the store; binary
+ * values compare by identity, so a JS write to it can't corrupt the
+ * store's equality checks, but it is seen by every reader of that value
  */
-SignalValue::SignalValue(double value)
-    : type_(Type::Number), boolValue_(false), numberValue_(value) {}
+class BinaryBuffer : public jsi::MutableBuffer {
+public:
+    explicit BinaryBuffer(SignalValue value) : value_(std::move(value)) {}
+
+    size_t size() const override { return value_.asBinary().size; }
+    uint8_t* data() override { return value_.asBinary().data; }
+
+private:
+    SignalValue value_;
+};
 
 /**
- * String constructor - stores string value
+ * ArrayBuffer.isView(object): true for TypedArrays and DataViews only, so
+ * plain objects that merely have a `buffer` property stay objects
  */
-SignalValue::SignalValue(const std::string& value)
-    : type_(Type::String), boolValue_(false), numberValue_(0.0), stringValue_(value) {}
+bool isArrayBufferView(jsi::Runtime& rt, const jsi::Object& object) {
+    jsi::Function isView = rt.global()
+        .getPropertyAsObject(rt, "ArrayBuffer")
+        .getPropertyAsFunction(rt, "isView");
+    jsi::Value result = isView.call(rt, jsi::Value(rt, object));
+    return result.isBool() && result.getBool();
+}
 
 /**
- * JSI Value constructor - converts JSI value to native C++ representation
- * This is the bridge from JavaScript types to C++ types
+ * Recursive conversion worker behind fromJSI
  */
-SignalValue::SignalValue(jsi::Runtime& rt, const jsi::Value& value) 
-    : boolValue_(false), numberValue_(0.0) {
-    
+SignalValue convertValue(jsi::Runtime& rt, const jsi::Value& value, size_t depth) {
     if (value.isUndefined()) {
-        type_ = Type::Undefined;
-    } else if (value.isNull()) {
-        type_ = Type::Null;
-    } else if (value.isBool()) {
-        type_ = Type::Boolean;
-        boolValue_ = value.getBool();
-    } else if (value.isNumber()) {
-        type_ = Type::Number;
-        numberValue_ = value.getNumber();
-    } else if (value.isString()) {
-        type_ = Type::String;
-        stringValue_ = value.getString(rt).utf8(rt);
-    } else {
-        // For objects, we serialize to JSON string for simplicity
-        // In production, you might want to use jsi::Object directly
-        type_ = Type::Object;
-        stringValue_ = value.toString(rt).utf8(rt);
+        return SignalValue();
+    }
+    if (value.isNull()) {
+        return SignalValue::null();
+    }
+    if (value.isBool()) {
+        return SignalValue(value.getBool());
+    }
+    if (value.isNumber()) {
+        return SignalValue(value.getNumber());
+    }
+    if (value.isString()) {
+        return SignalValue(value.getString(rt).utf8(rt));
+    }
+    if (!value.isObject()) {
+        // Symbols and BigInts have no native representation and stay undefined
+        return SignalValue();
+    }
+    
+    if (depth >= SignalValue::kMaxDepth) {
+        throw jsi::JSError(rt, "Signal value is nested too deeply (circular reference?)");
+    }
+    
+    jsi::Object object = value.getObject(rt);
+    if (object.isFunction(rt)) {
+        return SignalValue();
+    }
+    
+    if (object.isArrayBuffer(rt)) {
+        jsi::ArrayBuffer buffer = object.getArrayBuffer(rt);
+        return SignalValue::binary(buffer.data(rt), buffer.size(rt));
+    }
+    
+    // TypedArray views: copy only the viewed range and remember the type
+    // (the `buffer` check keeps the isView call off ordinary objects)
+    if (object.hasProperty(rt, "buffer") && isArrayBufferView(rt, object)) {
+        jsi::Value bufferValue = object.getProperty(rt, "buffer");
+        if (bufferValue.isObject() && bufferValue.getObject(rt).isArrayBuffer(rt)) {
+            jsi::ArrayBuffer buffer = bufferValue.getObject(rt).getArrayBuffer(rt);
+            size_t byteOffset = static_cast<size_t>(object.getProperty(rt, "byteOffset").asNumber());
+            size_t byteLength = static_cast<size_t>(object.getProperty(rt, "byteLength").asNumber());
+            if (byteOffset + byteLength > buffer.size(rt)) {
+                throw jsi::JSError(rt, "TypedArray view exceeds its ArrayBuffer");
+            }
+            
+            jsi::Value constructor = object.getProperty(rt, "constructor");
+            SignalValue::BinaryKind kind = SignalValue::BinaryKind::ArrayBuffer;
+            if (constructor.isObject()) {
+                jsi::Value name = constructor.getObject(rt).getProperty(rt, "name");
+                if (name.isString()) {
+                    kind = binaryKindFromName(name.getString(rt).utf8(rt));
+                }
+            }
+            return SignalValue::binary(buffer.data(rt) + byteOffset, byteLength, kind);
+        }
+    }
+    
+    if (object.isArray(rt)) {
+        jsi::Array jsArray = object.getArray(rt);
+        size_t length = jsArray.size(rt);
+        
+        SignalValue::ArrayElements elements;
+        elements.reserve(length);
+        for (size_t i = 0; i < length; i++) {
+            elements.push_back(convertValue(rt, jsArray.getValueAtIndex(rt, i), depth + 1));
+        }
+        return SignalValue::array(std::move(elements));
     }
+    
+    jsi::Array names = object.getPropertyNames(rt);
+    size_t length = names.size(rt);
+    
+    SignalValue::ObjectEntries entries;
+    entries.reserve(length);
+    for (size_t i = 0; i < length; i++) {
+        jsi::String name = names.getValueAtIndex(rt, i).getString(rt);
+        entries.emplace_back(
+            name.utf8(rt),
+            convertValue(rt, object.getProperty(rt, name), depth + 1));
+    }
+    return SignalValue::object(std::move(entries));
+}
+
+} // namespace
+
+/**
+ * JSI Value conversion - the bridge from JavaScript types to C++ types
+ */
+SignalValue fromJSI(jsi::Runtime& rt, const jsi::Value& value) {
+    return convertValue(rt, value, 0);
 }
 
 /**
  * Convert native C++ value back to JSI value for JavaScript consumption
  * This completes the round-trip: JS -> C++ -> JS
  */
-jsi::Value SignalValue::toJSI(jsi::Runtime& rt) const {
-    switch (type_) {
+jsi::Value toJSI(jsi::Runtime& rt, const SignalValue& value) {
+    using Type = SignalValue::Type;
+    using BinaryKind = SignalValue::BinaryKind;
+    
+    switch (value.getType()) {
         case Type::Undefined:
             return jsi::Value::undefined();
         case Type::Null:
             return jsi::Value::null();
         case Type::Boolean:
-            return jsi::Value(boolValue_);
+            return jsi::Value(value.asBoolean());
         case Type::Number:
-            return jsi::Value(numberValue_);
-        case Type::String:
-            return jsi::Value(rt, jsi::String::createFromUtf8(rt, stringValue_));
-        case Type::Object:
-            // Return the stringified version
-            return jsi::Value(rt, jsi::String::createFromUtf8(rt, stringValue_));
+            return jsi::Value(value.asNumber());
+        case Type::String: {
+            std::string_view text = value.asString();
+            return jsi::Value(rt, jsi::String::createFromUtf8(
+                rt, reinterpret_cast<const uint8_t*>(text.data()), text.size()));
+        }
+        case Type::Object: {
+            // Materialize a fresh JS object from the native tree
+            jsi::Object object(rt);
+            for (const auto& [name, child] : value.asObject()) {
+                object.setProperty(rt, jsi::PropNameID::forUtf8(rt, name), toJSI(rt, child));
+            }
+            return jsi::Value(rt, object);
+        }
+        case Type::Array: {
+            const SignalValue::ArrayElements& elements = value.asArray();
+            jsi::Array jsArray(rt, elements.size());
+            for (size_t i = 0; i < elements.size(); i++) {
+                jsArray.setValueAtIndex(rt, i, toJSI(rt, elements[i]));
+            }
+            return jsi::Value(rt, jsArray);
+        }
+        case Type::Binary: {
+            // Zero-copy: the ArrayBuffer aliases native memory owned by this value
+            jsi::ArrayBuffer buffer(rt, std::make_shared<BinaryBuffer>(value));
+            BinaryKind kind = value.asBinary().kind;
+            if (kind == BinaryKind::ArrayBuffer) {
+                return jsi::Value(rt, buffer);
+            }
+            jsi::Function constructor = rt.global().getPropertyAsFunction(
+                rt, kBinaryKindNames[static_cast<size_t>(kind)]);
+            return constructor.callAsConstructor(rt, buffer);
+        }
         default:
             return jsi::Value::undefined();
     }
 }
 
 // ============================================================================
-// Signal Implementation
+// JSI Bindings Installation
 // ============================================================================
 
 /**
- * Signal constructor - initializes with a value and version 0
- * version_ is atomic for lock-free reads in change detection
- */
-Signal::Signal(const SignalValue& initialValue)
-    : value_(initialValue), version_(0), nextSubscriberId_(0) {}
-
-/**
- * Thread-safe getValue - uses mutex to ensure consistent reads
- * Multiple threads can safely read the same signal
+ * Install JSI function bindings into the React Native runtime
+ * These functions become available on the global object in JavaScript
+ * 
+ * Each binding:
+ * 1. Extracts arguments from JavaScript (jsi::Value)
+ * 2. Converts to C++ types (SignalValue)
+ * 3. Calls native C++ function
+ * 4. Converts result back to JavaScript (jsi::Value)
+ * 
+ * Compatible with both Hermes and JSC engines
  */
-SignalValue Signal::getValue() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return value_;
-}
+namespace {
 
 /**
- * Thread-safe setValue - updates value and increments version atomically
- * The version bump allows React components to detect changes without locking
- * Notifies all subscribers after the update
- * FIXED: Copy subscribers before releasing mutex to prevent race condition
+ * Read a signal reference argument: numeric handle or string ID
+ * Returns an invalid handle for any other value
  */
-void Signal::setValue(const SignalValue& newValue) {
-    std::unordered_map<size_t, std::function<void(const SignalValue&)>> subscribersCopy;
-    SignalValue currentValue;
-    
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-        value_ = newValue;
-        // Atomic increment ensures version is always consistent
-        // memory_order_release ensures write is visible to other threads
-        version_.fetch_add(1, std::memory_order_release);
-        
-        // Copy subscribers and value while holding lock
-        subscribersCopy = subscribers_;
-        currentValue = value_;
-    }
-    
-    // Execute callbacks outside the lock to prevent deadlocks
-    for (const auto& [id, callback] : subscribersCopy) {
-        try {
-            callback(currentValue);
-        } catch (...) {
-            // Swallow exceptions to prevent one subscriber from breaking others
+SignalHandle readSignalHandle(jsi::Runtime& rt, const jsi::Value& arg) {
+    if (arg.isNumber()) {
+        double number = arg.getNumber();
+        if (number < 0 || number > 9007199254740991.0 || number != static_cast<double>(static_cast<uint64_t>(number))) {
+            return SignalHandle();
         }
+        return SignalHandle::fromBits(static_cast<uint64_t>(number));
     }
+    if (arg.isString()) {
+        return JSISignalStore::parseSignalId(arg.getString(rt).utf8(rt));
+    }
+    return SignalHandle();
 }
 
-/**
- * Subscribe to signal changes - returns unique subscription ID
- * Callbacks are executed when signal value changes
- */
-size_t Signal::subscribe(std::function<void(const SignalValue&)> callback) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    size_t id = nextSubscriberId_++;
-    subscribers_[id] = std::move(callback);
-    return id;
+bool isSignalReference(const jsi::Value& arg) {
+    return arg.isString() || arg.isNumber();
 }
 
 /**
- * Unsubscribe - removes callback using subscription ID
+ * Read a JS array of signal references (handles or string IDs)
+ * Entries that are not references become invalid handles
  */
-void Signal::unsubscribe(size_t id) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    subscribers_.erase(id);
+std::vector<SignalHandle> readSignalHandles(jsi::Runtime& rt, const jsi::Array& refs) {
+    size_t length = refs.size(rt);
+    std::vector<SignalHandle> handles;
+    handles.reserve(length);
+    for (size_t i = 0; i < length; i++) {
+        handles.push_back(readSignalHandle(rt, refs.getValueAtIndex(rt, i)));
+    }
+    return handles;
 }
 
-// ============================================================================
-// JSISignalStore Implementation
-// ============================================================================
-
-/**
- * Thread-safe singleton instance using Meyer's Singleton pattern
- * Guaranteed to be initialized exactly once in a thread-safe manner
- */
-JSISignalStore& JSISignalStore::getInstance() {
-    static JSISignalStore instance;
-    return instance;
+bool isArray(jsi::Runtime& rt, const jsi::Value& arg) {
+    return arg.isObject() && arg.getObject(rt).isArray(rt);
 }
 
 /**
- * Private constructor - initializes ID counter
+ * ChunkBuffer - jsi::MutableBuffer over one chunk of a shared store
+ * buffer (version counters, numeric values). Native writers update the
+ * elements in place; JS only reads them. Holding the chunk keeps its
+ * memory alive for as long as the JS ArrayBuffer exists
  */
-JSISignalStore::JSISignalStore() : nextSignalId_(0) {}
+template <typename Chunk>
+class ChunkBuffer : public jsi::MutableBuffer {
+public:
+    explicit ChunkBuffer(std::shared_ptr<Chunk> chunk) : chunk_(std::move(chunk)) {}
 
-/**
- * Generate unique signal ID using atomic counter + timestamp
- * Format: "sig_<counter>_<timestamp>"
- */
-std::string JSISignalStore::generateSignalId() {
-    auto counter = nextSignalId_.fetch_add(1, std::memory_order_relaxed);
-    auto now = std::chrono::system_clock::now().time_since_epoch().count();
-    
-    std::ostringstream oss;
-    oss << "sig_" << counter << "_" << now;
-    return oss.str();
-}
+    size_t size() const override { return sizeof(Chunk); }
+    uint8_t* data() override { return reinterpret_cast<uint8_t*>(chunk_->items); }
 
-/**
- * Create a new signal with initial value
- * Returns unique signal ID for future operations
- * Thread-safe: uses mutex to protect signals_ map
- */
-std::string JSISignalStore::createSignal(const SignalValue& initialValue) {
-    std::lock_guard<std::mutex> lock(storeMutex_);
-    
-    std::string id = generateSignalId();
-    // Use shared_ptr for automatic memory management
-    // Multiple owners can hold references safely
-    signals_[id] = std::make_shared<Signal>(initialValue);
-    
-    return id;
-}
+private:
+    std::shared_ptr<Chunk> chunk_;
+};
 
 /**
- * Get current value of a signal by ID
- * Throws if signal doesn't exist
+ * Wrap a shared buffer chunk in a typed array (undefined when the chunk
+ * doesn't exist yet)
  */
-SignalValue JSISignalStore::getSignal(const std::string& signalId) {
-    std::shared_ptr<Signal> signal;
-    
-    {
-        std::lock_guard<std::mutex> lock(storeMutex_);
-        auto it = signals_.find(signalId);
-        if (it == signals_.end()) {
-            throw std::runtime_error("Signal not found: " + signalId);
-        }
-        signal = it->second;  // Increment ref count
+template <typename Chunk>
+jsi::Value chunkToTypedArray(jsi::Runtime& rt, std::shared_ptr<Chunk> chunk, const char* arrayType) {
+    if (!chunk) {
+        return jsi::Value::undefined();
     }
-    
-    // Access signal outside the store lock
-    return signal->getValue();
+    jsi::ArrayBuffer buffer(rt, std::make_shared<ChunkBuffer<Chunk>>(std::move(chunk)));
+    jsi::Function constructor = rt.global().getPropertyAsFunction(rt, arrayType);
+    return constructor.callAsConstructor(rt, buffer);
 }
 
 /**
- * Update signal value by ID
- * Throws if signal doesn't exist
- * The version bump happens inside Signal::setValue
+ * Read a chunk index argument; -1 when out of range
  */
-void JSISignalStore::setSignal(const std::string& signalId, const SignalValue& value) {
-    std::shared_ptr<Signal> signal;
-    
-    {
-        std::lock_guard<std::mutex> lock(storeMutex_);
-        auto it = signals_.find(signalId);
-        if (it == signals_.end()) {
-            throw std::runtime_error("Signal not found: " + signalId);
-        }
-        signal = it->second;
+int64_t readChunkIndex(const jsi::Value& arg, uint32_t maxChunks) {
+    double index = arg.getNumber();
+    if (!(index >= 0) || index >= maxChunks) {
+        return -1;
     }
-    
-    // Update signal outside the store lock
-    signal->setValue(value);
+    return static_cast<int64_t>(index);
 }
 
 /**
- * Check if signal exists
+ * Deliver a signal's changes to a JS callback through the runtime's notifier
+ * The process-wide Signal only ever holds the notifier's queue, never the
+ * jsi::Function: the callback is called and released on the JS thread, and
+ * is dropped with the notifier when the runtime goes away
  */
-bool JSISignalStore::hasSignal(const std::string& signalId) {
-    std::lock_guard<std::mutex> lock(storeMutex_);
-    return signals_.find(signalId) != signals_.end();
+uint64_t subscribeCallback(jsi::Runtime& rt, CoalescedNotifier& notifier,
+                           std::shared_ptr<Signal> signal, const jsi::Value& callbackArg) {
+    auto callback = std::make_shared<jsi::Function>(callbackArg.getObject(rt).getFunction(rt));
+    jsi::Runtime* runtime = &rt;
+    return notifier.subscribe(std::move(signal), [callback, runtime](const SignalValue& value) {
+        callback->call(*runtime, toJSI(*runtime, value));
+    });
 }
 
 /**
- * Delete a signal by ID
- * shared_ptr automatically cleans up memory when no references remain
+ * SignalHostObject - JS handle bound to a single Signal
+ * Holds the Signal by shared_ptr, so property access never consults the
+ * store. Deleting the signal from the store detaches the object: it keeps
+ * working on its own copy but is no longer reachable by ID or handle
+ *
+ * Properties:
+ * - value (get/set)   current value; setting bumps the version
+ * - version (get)     change counter for cheap change detection
+ * - handle / id (get) store identity
+ * - subscribe (get)   subscribe(callback) -> unsubscribe()
  */
-void JSISignalStore::deleteSignal(const std::string& signalId) {
-    std::lock_guard<std::mutex> lock(storeMutex_);
-    signals_.erase(signalId);
-}
+class SignalHostObject : public jsi::HostObject {
+public:
+    SignalHostObject(std::shared_ptr<Signal> signal, SignalHandle handle,
+                     std::shared_ptr<CoalescedNotifier> notifier)
+        : signal_(std::move(signal)), handle_(handle), notifier_(std::move(notifier)) {}
 
-/**
- * Get current version number of a signal
- * Used for efficient change detection in React renders
- * Lock-free read using atomic operations
- */
-uint64_t JSISignalStore::getSignalVersion(const std::string& signalId) {
-    std::shared_ptr<Signal> signal;
-    
-    {
-        std::lock_guard<std::mutex> lock(storeMutex_);
-        auto it = signals_.find(signalId);
-        if (it == signals_.end()) {
-            throw std::runtime_error("Signal not found: " + signalId);
+    jsi::Value get(jsi::Runtime& rt, const jsi::PropNameID& propName) override {
+        std::string name = propName.utf8(rt);
+        
+        if (name == "value") {
+            return toJSI(rt, signal_->getValue());
+        }
+        if (name == "version") {
+            return jsi::Value(static_cast<double>(signal_->getVersion()));
         }
-        signal = it->second;
+        if (name == "handle") {
+            return jsi::Value(static_cast<double>(handle_.toBits()));
+        }
+        if (name == "id") {
+            return jsi::Value(rt, jsi::String::createFromUtf8(rt, JSISignalStore::formatSignalId(handle_)));
+        }
+        if (name == "subscribe") {
+            return createSubscribeFunction(rt);
+        }
+        return jsi::Value::undefined();
     }
-    
-    // Version is atomic - no lock needed for reading
-    return signal->getVersion();
-}
 
-/**
- * Batch update multiple signals atomically
- * More efficient than individual updates when changing many signals
- */
-void JSISignalStore::batchUpdate(const std::vector<std::pair<std::string, SignalValue>>& updates) {
-    std::vector<std::shared_ptr<Signal>> signalsToUpdate;
-    std::vector<SignalValue> valuesToSet;
-    
-    {
-        std::lock_guard<std::mutex> lock(storeMutex_);
-        signalsToUpdate.reserve(updates.size());
-        valuesToSet.reserve(updates.size());
-        
-        for (const auto& [signalId, value] : updates) {
-            auto it = signals_.find(signalId);
-            if (it != signals_.end()) {
-                signalsToUpdate.push_back(it->second);
-                valuesToSet.push_back(value);
-            }
+    void set(jsi::Runtime& rt, const jsi::PropNameID& propName, const jsi::Value& value) override {
+        if (propName.utf8(rt) != "value") {
+            throw jsi::JSError(rt, "Signal object only supports assigning 'value'");
         }
+        signal_->setValue(fromJSI(rt, value));
     }
-    
-    // Update all signals outside the store lock
-    for (size_t i = 0; i < signalsToUpdate.size(); ++i) {
-        signalsToUpdate[i]->setValue(valuesToSet[i]);
+
+    std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& rt) override {
+        std::vector<jsi::PropNameID> names;
+        names.push_back(jsi::PropNameID::forAscii(rt, "value"));
+        names.push_back(jsi::PropNameID::forAscii(rt, "version"));
+        names.push_back(jsi::PropNameID::forAscii(rt, "handle"));
+        names.push_back(jsi::PropNameID::forAscii(rt, "id"));
+        names.push_back(jsi::PropNameID::forAscii(rt, "subscribe"));
+        return names;
     }
-}
 
-/**
- * Get total number of signals in the store
- */
-size_t JSISignalStore::getSignalCount() const {
-    std::lock_guard<std::mutex> lock(storeMutex_);
-    return signals_.size();
-}
+private:
+    std::shared_ptr<Signal> signal_;
+    SignalHandle handle_;
+    std::shared_ptr<CoalescedNotifier> notifier_;  // Null without a jsInvoker
 
-/**
- * Clear all signals from the store
- * Useful for testing or memory cleanup
- */
-void JSISignalStore::clear() {
-    std::lock_guard<std::mutex> lock(storeMutex_);
-    signals_.clear();
-}
+    /**
+     * subscribe(callback) -> unsubscribe
+     * Same delivery as __signalForgeSubscribe: callbacks run on the JS
+     * thread after the signal changes, from any thread, with the latest
+     * value per tick. Subscriptions the caller never ends are torn down
+     * with the runtime
+     */
+    jsi::Value createSubscribeFunction(jsi::Runtime& rt) {
+        return jsi::Function::createFromHostFunction(
+            rt,
+            jsi::PropNameID::forAscii(rt, "subscribe"),
+            1,
+            [signal = signal_, notifier = notifier_](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+                if (count < 1 || !args[0].isObject() || !args[0].getObject(rt).isFunction(rt)) {
+                    throw jsi::JSError(rt, "subscribe requires a callback function");
+                }
+                if (!notifier) {
+                    throw jsi::JSError(rt, "subscribe requires bindings installed with a CallInvoker");
+                }
+                
+                uint64_t id = subscribeCallback(rt, *notifier, signal, args[0]);
+                return jsi::Function::createFromHostFunction(
+                    rt,
+                    jsi::PropNameID::forAscii(rt, "unsubscribe"),
+                    0,
+                    [notifier, id](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+                        notifier->unsubscribe(id);
+                        return jsi::Value::undefined();
+                    });
+            });
+    }
+};
 
-// ============================================================================
-// JSI Bindings Installation
-// ============================================================================
+} // namespace
 
-/**
- * Install JSI function bindings into the React Native runtime
- * These functions become available on the global object in JavaScript
- * 
- * Each binding:
- * 1. Extracts arguments from JavaScript (jsi::Value)
- * 2. Converts to C++ types (SignalValue)
- * 3. Calls native C++ function
- * 4. Converts result back to JavaScript (jsi::Value)
- * 
- * Compatible with both Hermes and JSC engines
- */
-void installJSIBindings(jsi::Runtime& runtime) {
+void installJSIBindings(jsi::Runtime& runtime, std::shared_ptr<react::CallInvoker> jsInvoker) {
     auto& store = JSISignalStore::getInstance();
     
+    // One notifier per runtime for JS subscriptions, shared by the signal
+    // objects and subscribe functions below. Only JS values own it, so it
+    // is destroyed on the JS thread when the runtime is torn down (e.g. on
+    // reload), unhooking every subscription from the process-wide signals
+    std::shared_ptr<CoalescedNotifier> notifier;
+    if (jsInvoker) {
+        notifier = std::make_shared<CoalescedNotifier>(
+            [jsInvoker](std::function<void()> task) { jsInvoker->invokeAsync(std::move(task)); });
+    }
+    
     /**
      * __signalForgeCreateSignal(initialValue) -> signalId
      * Creates a new signal and returns its unique ID
@@ -361,7 +461,7 @@ void installJSIBindings(jsi::Runtime& runtime) {
             }
             
             // Convert JSI value to native SignalValue
-            SignalValue initialValue(rt, args[0]);
+            SignalValue initialValue = fromJSI(rt, args[0]);
             
             // Create signal in C++ store
             std::string signalId = store.createSignal(initialValue);
@@ -372,6 +472,26 @@ void installJSIBindings(jsi::Runtime& runtime) {
     );
     runtime.global().setProperty(runtime, "__signalForgeCreateSignal", std::move(createSignalFunc));
     
+    /**
+     * __signalForgeCreateHandle(initialValue) -> handle
+     * Creates a new signal and returns its numeric handle
+     * Handles skip string ID formatting, conversion and parsing entirely
+     */
+    auto createHandleFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeCreateHandle"),
+        1,
+        [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 1) {
+                throw jsi::JSError(rt, "createHandle requires 1 argument");
+            }
+            
+            SignalHandle handle = store.createSignalHandle(fromJSI(rt, args[0]));
+            return jsi::Value(static_cast<double>(handle.toBits()));
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeCreateHandle", std::move(createHandleFunc));
+    
     /**
      * __signalForgeGetSignal(signalId) -> value
      * Retrieves the current value of a signal
@@ -381,17 +501,17 @@ void installJSIBindings(jsi::Runtime& runtime) {
         jsi::PropNameID::forAscii(runtime, "__signalForgeGetSignal"),
         1,
         [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
-            if (count < 1 || !args[0].isString()) {
-                throw jsi::JSError(rt, "getSignal requires a string signal ID");
+            if (count < 1 || !isSignalReference(args[0])) {
+                throw jsi::JSError(rt, "getSignal requires a signal ID or handle");
             }
             
-            std::string signalId = args[0].getString(rt).utf8(rt);
+            SignalHandle handle = readSignalHandle(rt, args[0]);
             
             try {
                 // Fetch value from C++ store
-                SignalValue value = store.getSignal(signalId);
+                SignalValue value = store.getSignal(handle);
                 // Convert back to JavaScript value
-                return value.toJSI(rt);
+                return toJSI(rt, value);
             } catch (const std::exception& e) {
                 throw jsi::JSError(rt, e.what());
             }
@@ -399,6 +519,58 @@ void installJSIBindings(jsi::Runtime& runtime) {
     );
     runtime.global().setProperty(runtime, "__signalForgeGetSignal", std::move(getSignalFunc));
     
+    /**
+     * __signalForgeGetMany([signalId, ...]) -> [value, ...]
+     * Reads many signals in one host call; each store shard is locked once.
+     * Unknown signals read as undefined
+     */
+    auto getManyFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeGetMany"),
+        1,
+        [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 1 || !isArray(rt, args[0])) {
+                throw jsi::JSError(rt, "getMany requires an array of signal IDs or handles");
+            }
+            
+            std::vector<SignalValue> values =
+                store.getSignals(readSignalHandles(rt, args[0].getObject(rt).getArray(rt)));
+            
+            jsi::Array result(rt, values.size());
+            for (size_t i = 0; i < values.size(); i++) {
+                result.setValueAtIndex(rt, i, toJSI(rt, values[i]));
+            }
+            return jsi::Value(rt, result);
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeGetMany", std::move(getManyFunc));
+    
+    /**
+     * __signalForgeGetManyInto([signalId, ...], target) -> number
+     * Like getMany, but writes values into target[0..n) so a caller can
+     * reuse one array across frames. Returns the number of values written
+     */
+    auto getManyIntoFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeGetManyInto"),
+        2,
+        [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 2 || !isArray(rt, args[0]) || !isArray(rt, args[1])) {
+                throw jsi::JSError(rt, "getManyInto requires an array of signal IDs or handles and a target array");
+            }
+            
+            std::vector<SignalValue> values =
+                store.getSignals(readSignalHandles(rt, args[0].getObject(rt).getArray(rt)));
+            
+            jsi::Array target = args[1].getObject(rt).getArray(rt);
+            for (size_t i = 0; i < values.size(); i++) {
+                target.setValueAtIndex(rt, i, toJSI(rt, values[i]));
+            }
+            return jsi::Value(static_cast<double>(values.size()));
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeGetManyInto", std::move(getManyIntoFunc));
+    
     /**
      * __signalForgeSetSignal(signalId, newValue) -> void
      * Updates a signal's value and increments its version
@@ -408,17 +580,17 @@ void installJSIBindings(jsi::Runtime& runtime) {
         jsi::PropNameID::forAscii(runtime, "__signalForgeSetSignal"),
         2,
         [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
-            if (count < 2 || !args[0].isString()) {
+            if (count < 2 || !isSignalReference(args[0])) {
                 throw jsi::JSError(rt, "setSignal requires signal ID and new value");
             }
             
-            std::string signalId = args[0].getString(rt).utf8(rt);
-            SignalValue newValue(rt, args[1]);
+            SignalHandle handle = readSignalHandle(rt, args[0]);
+            SignalValue newValue = fromJSI(rt, args[1]);
             
             try {
                 // Update signal in C++ store
                 // This will increment the atomic version counter
-                store.setSignal(signalId, newValue);
+                store.setSignal(handle, newValue);
                 return jsi::Value::undefined();
             } catch (const std::exception& e) {
                 throw jsi::JSError(rt, e.what());
@@ -436,12 +608,11 @@ void installJSIBindings(jsi::Runtime& runtime) {
         jsi::PropNameID::forAscii(runtime, "__signalForgeHasSignal"),
         1,
         [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
-            if (count < 1 || !args[0].isString()) {
-                throw jsi::JSError(rt, "hasSignal requires a string signal ID");
+            if (count < 1 || !isSignalReference(args[0])) {
+                throw jsi::JSError(rt, "hasSignal requires a signal ID or handle");
             }
             
-            std::string signalId = args[0].getString(rt).utf8(rt);
-            bool exists = store.hasSignal(signalId);
+            bool exists = store.hasSignal(readSignalHandle(rt, args[0]));
             
             return jsi::Value(exists);
         }
@@ -457,12 +628,11 @@ void installJSIBindings(jsi::Runtime& runtime) {
         jsi::PropNameID::forAscii(runtime, "__signalForgeDeleteSignal"),
         1,
         [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
-            if (count < 1 || !args[0].isString()) {
-                throw jsi::JSError(rt, "deleteSignal requires a string signal ID");
+            if (count < 1 || !isSignalReference(args[0])) {
+                throw jsi::JSError(rt, "deleteSignal requires a signal ID or handle");
             }
             
-            std::string signalId = args[0].getString(rt).utf8(rt);
-            store.deleteSignal(signalId);
+            store.deleteSignal(readSignalHandle(rt, args[0]));
             
             return jsi::Value::undefined();
         }
@@ -479,15 +649,15 @@ void installJSIBindings(jsi::Runtime& runtime) {
         jsi::PropNameID::forAscii(runtime, "__signalForgeGetVersion"),
         1,
         [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
-            if (count < 1 || !args[0].isString()) {
-                throw jsi::JSError(rt, "getVersion requires a string signal ID");
+            if (count < 1 || !isSignalReference(args[0])) {
+                throw jsi::JSError(rt, "getVersion requires a signal ID or handle");
             }
             
-            std::string signalId = args[0].getString(rt).utf8(rt);
+            SignalHandle handle = readSignalHandle(rt, args[0]);
             
             try {
-                // Atomic read - no locking overhead
-                uint64_t version = store.getSignalVersion(signalId);
+                // Lock-free for plain signals; stale computeds refresh first
+                uint64_t version = store.getSignalVersion(handle);
                 return jsi::Value(static_cast<double>(version));
             } catch (const std::exception& e) {
                 throw jsi::JSError(rt, e.what());
@@ -496,10 +666,236 @@ void installJSIBindings(jsi::Runtime& runtime) {
     );
     runtime.global().setProperty(runtime, "__signalForgeGetVersion", std::move(getVersionFunc));
     
+    /**
+     * __signalForgeGetVersionBuffer(chunkIndex) -> Uint32Array | undefined
+     * Live view of one chunk of per-slot change counters. Slot S (the low
+     * 32 bits of a handle) is element S & (chunkSize - 1) of chunk
+     * S >> __signalForgeVersionChunkShift. Counters change whenever the
+     * slot's signal changes, so polling them needs no host call
+     */
+    auto getVersionBufferFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeGetVersionBuffer"),
+        1,
+        [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 1 || !args[0].isNumber()) {
+                throw jsi::JSError(rt, "getVersionBuffer requires a chunk index");
+            }
+            
+            int64_t index = readChunkIndex(args[0], JSISignalStore::VersionBuffer::kMaxChunks);
+            if (index < 0) {
+                return jsi::Value::undefined();
+            }
+            return chunkToTypedArray(rt, store.getVersionChunk(static_cast<uint32_t>(index)), "Uint32Array");
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeGetVersionBuffer", std::move(getVersionBufferFunc));
+    runtime.global().setProperty(runtime, "__signalForgeVersionChunkShift",
+        static_cast<double>(JSISignalStore::VersionBuffer::kChunkShift));
+    
+    /**
+     * __signalForgeCreateNumericSignal(initialValue) -> { handle, id, cell }
+     * Creates a number-only signal whose value also lives in cell `cell`
+     * of the shared numeric buffer (see __signalForgeGetNumericBuffer)
+     */
+    auto createNumericSignalFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeCreateNumericSignal"),
+        1,
+        [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 1 || !args[0].isNumber()) {
+                throw jsi::JSError(rt, "createNumericSignal requires a number");
+            }
+            
+            try {
+                SignalHandle handle = store.createNumericSignal(args[0].getNumber());
+                jsi::Object result(rt);
+                result.setProperty(rt, "handle", static_cast<double>(handle.toBits()));
+                result.setProperty(rt, "id", jsi::String::createFromUtf8(rt, JSISignalStore::formatSignalId(handle)));
+                result.setProperty(rt, "cell", static_cast<double>(store.getNumericCell(handle)));
+                return jsi::Value(rt, result);
+            } catch (const std::exception& e) {
+                throw jsi::JSError(rt, e.what());
+            }
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeCreateNumericSignal", std::move(createNumericSignalFunc));
+    
+    /**
+     * __signalForgeSetNumber(signalId, number) -> void
+     * Number-only write: skips generic value conversion, then bumps the
+     * version and notifies like setSignal
+     */
+    auto setNumberFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeSetNumber"),
+        2,
+        [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 2 || !isSignalReference(args[0]) || !args[1].isNumber()) {
+                throw jsi::JSError(rt, "setNumber requires a signal ID or handle and a number");
+            }
+            
+            try {
+                store.setSignal(readSignalHandle(rt, args[0]), SignalValue(args[1].getNumber()));
+                return jsi::Value::undefined();
+            } catch (const std::exception& e) {
+                throw jsi::JSError(rt, e.what());
+            }
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeSetNumber", std::move(setNumberFunc));
+    
+    /**
+     * __signalForgeAdd(signalId, delta) -> number
+     * __signalForgeIncrement(signalId) -> number
+     * __signalForgeMin(signalId, number) -> number
+     * __signalForgeMax(signalId, number) -> number
+     * Atomic read-modify-write on any signal holding a number: no lost
+     * updates against native writers, at most one version bump. Each
+     * returns the resulting value
+     */
+    struct NumericUpdate {
+        const char* name;
+        const char* label;  // For error messages
+        Signal::NumericOp op;
+        bool takesOperand;  // Increment adds 1
+    };
+    const NumericUpdate numericUpdates[] = {
+        {"__signalForgeAdd", "add", Signal::NumericOp::Add, true},
+        {"__signalForgeIncrement", "increment", Signal::NumericOp::Add, false},
+        {"__signalForgeMin", "min", Signal::NumericOp::Min, true},
+        {"__signalForgeMax", "max", Signal::NumericOp::Max, true},
+    };
+    for (const NumericUpdate& update : numericUpdates) {
+        auto updateFunc = jsi::Function::createFromHostFunction(
+            runtime,
+            jsi::PropNameID::forAscii(runtime, update.name),
+            update.takesOperand ? 2 : 1,
+            [&store, update](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+                bool valid = count >= 1 && isSignalReference(args[0]) &&
+                    (!update.takesOperand || (count >= 2 && args[1].isNumber()));
+                if (!valid) {
+                    throw jsi::JSError(rt, std::string(update.label) +
+                        (update.takesOperand ? " requires a signal ID or handle and a number"
+                                             : " requires a signal ID or handle"));
+                }
+                
+                double operand = update.takesOperand ? args[1].getNumber() : 1.0;
+                try {
+                    return jsi::Value(store.updateNumber(readSignalHandle(rt, args[0]), update.op, operand));
+                } catch (const std::exception& e) {
+                    throw jsi::JSError(rt, e.what());
+                }
+            }
+        );
+        runtime.global().setProperty(runtime, update.name, std::move(updateFunc));
+    }
+    
+    /**
+     * __signalForgeCompareAndSet(signalId, expectedVersion, value) -> boolean
+     * Writes value only if the signal's version (__signalForgeGetVersion)
+     * is still expectedVersion; false means another write came first
+     */
+    auto compareAndSetFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeCompareAndSet"),
+        3,
+        [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 3 || !isSignalReference(args[0]) || !args[1].isNumber()) {
+                throw jsi::JSError(rt, "compareAndSet requires a signal ID or handle, a version and a value");
+            }
+            
+            double expected = args[1].getNumber();
+            if (!(expected >= 0 && expected <= 9007199254740991.0) || std::trunc(expected) != expected) {
+                return jsi::Value(false);  // No signal ever has this version
+            }
+            
+            try {
+                SignalHandle handle = readSignalHandle(rt, args[0]);
+                return jsi::Value(store.compareAndSet(handle, static_cast<uint64_t>(expected), fromJSI(rt, args[2])));
+            } catch (const std::exception& e) {
+                throw jsi::JSError(rt, e.what());
+            }
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeCompareAndSet", std::move(compareAndSetFunc));
+    
+    /**
+     * __signalForgeGetNumericBuffer(chunkIndex) -> Float64Array | undefined
+     * Live view of numeric cells: cell C is element C & (chunkSize - 1) of
+     * chunk C >> __signalForgeNumericChunkShift
+     */
+    auto getNumericBufferFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeGetNumericBuffer"),
+        1,
+        [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 1 || !args[0].isNumber()) {
+                throw jsi::JSError(rt, "getNumericBuffer requires a chunk index");
+            }
+            
+            int64_t index = readChunkIndex(args[0], JSISignalStore::NumericBuffer::kMaxChunks);
+            if (index < 0) {
+                return jsi::Value::undefined();
+            }
+            return chunkToTypedArray(rt, store.getNumericChunk(static_cast<uint32_t>(index)), "Float64Array");
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeGetNumericBuffer", std::move(getNumericBufferFunc));
+    runtime.global().setProperty(runtime, "__signalForgeNumericChunkShift",
+        static_cast<double>(JSISignalStore::NumericBuffer::kChunkShift));
+    
+    /**
+     * __signalForgeCreateComputed(expression, inputs) -> handle
+     * Compiles `expression` (see Expression) and creates a read-only
+     * computed signal over `inputs`, an object mapping each variable name
+     * to a signal ID or handle. Recomputes run natively, with no JS call
+     */
+    auto createComputedFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeCreateComputed"),
+        2,
+        [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 2 || !args[0].isString() || !args[1].isObject()) {
+                throw jsi::JSError(rt, "createComputed requires an expression string and an inputs object");
+            }
+            
+            std::shared_ptr<const Expression> expression;
+            try {
+                expression = std::make_shared<const Expression>(
+                    Expression::compile(args[0].getString(rt).utf8(rt)));
+            } catch (const std::exception& e) {
+                throw jsi::JSError(rt, e.what());
+            }
+            
+            jsi::Object inputs = args[1].getObject(rt);
+            std::vector<SignalHandle> dependencies;
+            dependencies.reserve(expression->variables().size());
+            for (const std::string& name : expression->variables()) {
+                jsi::Value ref = inputs.getProperty(rt, name.c_str());
+                if (!isSignalReference(ref)) {
+                    throw jsi::JSError(rt, "createComputed: no signal bound to '" + name + "'");
+                }
+                dependencies.push_back(readSignalHandle(rt, ref));
+            }
+            
+            try {
+                SignalHandle handle = store.createComputed(dependencies,
+                    [expression](const std::vector<SignalValue>& values) {
+                        return expression->evaluate(values);
+                    });
+                return jsi::Value(static_cast<double>(handle.toBits()));
+            } catch (const std::exception& e) {
+                throw jsi::JSError(rt, e.what());
+            }
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeCreateComputed", std::move(createComputedFunc));
+    
     /**
      * __signalForgeBatchUpdate(updates) -> void
      * Update multiple signals in one operation
-     * Expects array of [signalId, value] pairs
+     * Expects array of [signalId | handle, value] pairs
      */
     auto batchUpdateFunc = jsi::Function::createFromHostFunction(
         runtime,
@@ -513,21 +909,148 @@ void installJSIBindings(jsi::Runtime& runtime) {
             auto updatesArray = args[0].getObject(rt).getArray(rt);
             size_t length = updatesArray.size(rt);
             
-            std::vector<std::pair<std::string, SignalValue>> updates;
+            std::vector<std::pair<SignalHandle, SignalValue>> updates;
             updates.reserve(length);
             
             for (size_t i = 0; i < length; i++) {
                 auto updateObj = updatesArray.getValueAtIndex(rt, i).getObject(rt).getArray(rt);
-                std::string signalId = updateObj.getValueAtIndex(rt, 0).getString(rt).utf8(rt);
-                SignalValue value(rt, updateObj.getValueAtIndex(rt, 1));
-                updates.emplace_back(signalId, value);
+                SignalHandle handle = readSignalHandle(rt, updateObj.getValueAtIndex(rt, 0));
+                SignalValue value = fromJSI(rt, updateObj.getValueAtIndex(rt, 1));
+                updates.emplace_back(handle, std::move(value));
             }
             
-            store.batchUpdate(updates);
+            try {
+                store.batchUpdate(updates);
+            } catch (const std::exception& e) {
+                throw jsi::JSError(rt, e.what());
+            }
             return jsi::Value::undefined();
         }
     );
     runtime.global().setProperty(runtime, "__signalForgeBatchUpdate", std::move(batchUpdateFunc));
+    
+    /**
+     * __signalForgeCreateSignalObject(initialValue) -> signal object
+     * Creates a new signal and returns its host object in one crossing
+     */
+    auto createSignalObjectFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeCreateSignalObject"),
+        1,
+        [&store, notifier](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 1) {
+                throw jsi::JSError(rt, "createSignalObject requires 1 argument");
+            }
+            
+            SignalHandle handle = store.createSignalHandle(fromJSI(rt, args[0]));
+            auto hostObject = std::make_shared<SignalHostObject>(store.lookupSignal(handle), handle, notifier);
+            return jsi::Object::createFromHostObject(rt, std::move(hostObject));
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeCreateSignalObject", std::move(createSignalObjectFunc));
+    
+    /**
+     * __signalForgeGetSignalObject(signalId) -> signal object
+     * Returns a host object bound to an existing signal
+     */
+    auto getSignalObjectFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeGetSignalObject"),
+        1,
+        [&store, notifier](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 1 || !isSignalReference(args[0])) {
+                throw jsi::JSError(rt, "getSignalObject requires a signal ID or handle");
+            }
+            
+            SignalHandle handle = readSignalHandle(rt, args[0]);
+            std::shared_ptr<Signal> signal = store.lookupSignal(handle);
+            if (!signal) {
+                throw jsi::JSError(rt, "Signal not found: " + JSISignalStore::formatSignalId(handle));
+            }
+            
+            auto hostObject = std::make_shared<SignalHostObject>(std::move(signal), handle, notifier);
+            return jsi::Object::createFromHostObject(rt, std::move(hostObject));
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeGetSignalObject", std::move(getSignalObjectFunc));
+    
+    /**
+     * __signalForgeGetPoolStats() -> { blockSize, slabCount, liveBlocks, ... }
+     * Occupancy counters for the slab pools backing native signals
+     */
+    auto getPoolStatsFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeGetPoolStats"),
+        0,
+        [&store](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            SlabPool::Stats stats = store.getSignalPoolStats();
+            
+            jsi::Object result(rt);
+            result.setProperty(rt, "blockSize", static_cast<double>(stats.blockSize));
+            result.setProperty(rt, "blocksPerSlab", static_cast<double>(stats.blocksPerSlab));
+            result.setProperty(rt, "slabCount", static_cast<double>(stats.slabCount));
+            result.setProperty(rt, "liveBlocks", static_cast<double>(stats.liveBlocks));
+            result.setProperty(rt, "freeBlocks", static_cast<double>(stats.freeBlocks));
+            result.setProperty(rt, "totalAllocations", static_cast<double>(stats.totalAllocations));
+            result.setProperty(rt, "bytesReserved", static_cast<double>(stats.bytesReserved));
+            result.setProperty(rt, "signalCount", static_cast<double>(store.getSignalCount()));
+            return jsi::Value(rt, result);
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeGetPoolStats", std::move(getPoolStatsFunc));
+    
+    if (!notifier) {
+        return;
+    }
+    
+    /**
+     * __signalForgeSubscribe(signalId, callback) -> subscriptionId
+     * Calls callback(value) on the JS thread after the signal changes, from
+     * any thread. Changes are queued and delivered by one CallInvoker task
+     * per tick, with only the latest value per subscription
+     */
+    auto subscribeFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeSubscribe"),
+        2,
+        [&store, notifier](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 2 || !isSignalReference(args[0]) || !args[1].isObject() ||
+                !args[1].getObject(rt).isFunction(rt)) {
+                throw jsi::JSError(rt, "subscribe requires a signal ID or handle and a callback function");
+            }
+            
+            SignalHandle handle = readSignalHandle(rt, args[0]);
+            std::shared_ptr<Signal> signal = store.lookupSignal(handle);
+            if (!signal) {
+                throw jsi::JSError(rt, "Signal not found: " + JSISignalStore::formatSignalId(handle));
+            }
+            
+            uint64_t id = subscribeCallback(rt, *notifier, std::move(signal), args[1]);
+            return jsi::Value(static_cast<double>(id));
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeSubscribe", std::move(subscribeFunc));
+    
+    /**
+     * __signalForgeUnsubscribe(subscriptionId) -> boolean
+     * Stops delivery immediately, including changes already queued
+     */
+    auto unsubscribeFunc = jsi::Function::createFromHostFunction(
+        runtime,
+        jsi::PropNameID::forAscii(runtime, "__signalForgeUnsubscribe"),
+        1,
+        [notifier](jsi::Runtime& rt, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+            if (count < 1 || !args[0].isNumber()) {
+                throw jsi::JSError(rt, "unsubscribe requires a subscription ID");
+            }
+            double id = args[0].getNumber();
+            if (id < 1 || id > 9007199254740991.0 || id != static_cast<double>(static_cast<uint64_t>(id))) {
+                return jsi::Value(false);
+            }
+            return jsi::Value(notifier->unsubscribe(static_cast<uint64_t>(id)));
+        }
+    );
+    runtime.global().setProperty(runtime, "__signalForgeUnsubscribe", std::move(unsubscribeFunc));
 }
 
 } // namespace signalforge
@@ -1,130 +1,191 @@
 #pragma once
 
 #include <jsi/jsi.h>
+#include <ReactCommon/CallInvoker.h>
+#include <cmath>
 #include <memory>
-#include <unordered_map>
-#include <atomic>
-#include <mutex>
 #include <string>
-#include <functional>
+#include <vector>
+#include "signalStore.h"
+#include "typedSignal.h"
 
 using namespace facebook;
 
 namespace signalforge {
 
 /**
- * SignalValue - Type-safe wrapper for signal values
- * Supports primitive types and can be extended for complex objects
+ * Convert a JS value into a native SignalValue
+ * Objects and arrays are walked into native trees, ArrayBuffers and
+ * TypedArrays are copied once into native memory, functions become
+ * undefined (matching JSON semantics) and nesting is capped at
+ * SignalValue::kMaxDepth
  */
-class SignalValue {
-public:
-    enum class Type {
-        Undefined,
-        Null,
-        Boolean,
-        Number,
-        String,
-        Object
-    };
-
-    SignalValue();
-    explicit SignalValue(bool value);
-    explicit SignalValue(double value);
-    explicit SignalValue(const std::string& value);
-    explicit SignalValue(jsi::Runtime& rt, const jsi::Value& value);
-
-    Type getType() const { return type_; }
-    bool asBoolean() const { return boolValue_; }
-    double asNumber() const { return numberValue_; }
-    const std::string& asString() const { return stringValue_; }
-    
-    jsi::Value toJSI(jsi::Runtime& rt) const;
+SignalValue fromJSI(jsi::Runtime& rt, const jsi::Value& value);
 
-private:
-    Type type_;
-    bool boolValue_;
-    double numberValue_;
-    std::string stringValue_;
-};
+/**
+ * Convert a native SignalValue back into a JS value
+ * Binary values come back as ArrayBuffers (or TypedArray views) that alias
+ * the native bytes instead of copying them. JS should treat them as
+ * read-only: in-place writes are seen by every reader of the value and
+ * don't notify, since binary values compare by identity
+ */
+jsi::Value toJSI(jsi::Runtime& rt, const SignalValue& value);
 
 /**
- * Signal - Core signal container with atomic version tracking
- * Uses shared_ptr for automatic memory management
- * Version counter enables efficient change detection
+ * TypedJSI<T> - JSI conversion for TypedSignal value types, picked at
+ * compile time instead of switching on SignalValue::Type. fromJSI throws
+ * jsi::JSError when the JS value doesn't fit T
  */
-class Signal {
-public:
-    explicit Signal(const SignalValue& initialValue);
-    
-    SignalValue getValue() const;
-    void setValue(const SignalValue& newValue);
-    uint64_t getVersion() const { return version_.load(std::memory_order_acquire); }
-    
-    // Subscribe a callback that fires when signal changes
-    size_t subscribe(std::function<void(const SignalValue&)> callback);
-    void unsubscribe(size_t id);
+template <typename T>
+struct TypedJSI;
 
-private:
-    mutable std::mutex mutex_;  // Protects value_ during read/write
-    SignalValue value_;
-    std::atomic<uint64_t> version_;  // Thread-safe change tracking
-    
-    std::unordered_map<size_t, std::function<void(const SignalValue&)>> subscribers_;
-    size_t nextSubscriberId_;
-    
-    void notifySubscribers();
+template <>
+struct TypedJSI<double> {
+    static jsi::Value toJSI(jsi::Runtime&, double value) { return jsi::Value(value); }
+    static double fromJSI(jsi::Runtime& rt, const jsi::Value& value) {
+        if (!value.isNumber()) {
+            throw jsi::JSError(rt, "Expected a number");
+        }
+        return value.getNumber();
+    }
+};
+
+// Crosses into JS as a number, so only safe integers are accepted
+template <>
+struct TypedJSI<int64_t> {
+    static constexpr double kMaxSafeInteger = 9007199254740991.0;
+
+    static jsi::Value toJSI(jsi::Runtime&, int64_t value) { return jsi::Value(static_cast<double>(value)); }
+    static int64_t fromJSI(jsi::Runtime& rt, const jsi::Value& value) {
+        if (!value.isNumber()) {
+            throw jsi::JSError(rt, "Expected an integer");
+        }
+        double number = value.getNumber();
+        if (std::trunc(number) != number || std::fabs(number) > kMaxSafeInteger) {
+            throw jsi::JSError(rt, "Expected a safe integer");
+        }
+        return static_cast<int64_t>(number);
+    }
+};
+
+template <>
+struct TypedJSI<bool> {
+    static jsi::Value toJSI(jsi::Runtime&, bool value) { return jsi::Value(value); }
+    static bool fromJSI(jsi::Runtime& rt, const jsi::Value& value) {
+        if (!value.isBool()) {
+            throw jsi::JSError(rt, "Expected a boolean");
+        }
+        return value.getBool();
+    }
+};
+
+template <>
+struct TypedJSI<std::string> {
+    static jsi::Value toJSI(jsi::Runtime& rt, const std::string& value) {
+        return jsi::Value(rt, jsi::String::createFromUtf8(rt, value));
+    }
+    static std::string fromJSI(jsi::Runtime& rt, const jsi::Value& value) {
+        if (!value.isString()) {
+            throw jsi::JSError(rt, "Expected a string");
+        }
+        return value.getString(rt).utf8(rt);
+    }
+};
+
+// Zero-copy towards JS (the ArrayBuffer aliases the buffer's memory);
+// ArrayBuffers and TypedArrays from JS are copied once
+template <>
+struct TypedJSI<SignalBuffer> {
+    static jsi::Value toJSI(jsi::Runtime& rt, const SignalBuffer& value) {
+        return signalforge::toJSI(rt, SignalTraits<SignalBuffer>::toValue(value));
+    }
+    static SignalBuffer fromJSI(jsi::Runtime& rt, const jsi::Value& value) {
+        auto converted = std::make_shared<SignalValue>(signalforge::fromJSI(rt, value));
+        if (converted->getType() != SignalValue::Type::Binary) {
+            throw jsi::JSError(rt, "Expected an ArrayBuffer or TypedArray");
+        }
+        SignalValue::BinaryView view = converted->asBinary();
+        return SignalBuffer{std::move(converted), view.data, view.size, view.kind};
+    }
 };
 
 /**
- * JSISignalStore - Main store managing all signals
- * Thread-safe singleton with JSI function bindings
- * Provides direct C++ memory access for React Native
+ * TypedSignalHostObject<T> - JS object bound to a TypedSignal
+ * Same shape as the store's signal objects without the store identity:
+ * - value (get/set)   converted through TypedJSI<T>
+ * - version (get)     change counter
  */
-class JSISignalStore {
+template <typename T>
+class TypedSignalHostObject : public jsi::HostObject {
 public:
-    static JSISignalStore& getInstance();
-    
-    // Delete copy/move constructors for singleton
-    JSISignalStore(const JSISignalStore&) = delete;
-    JSISignalStore& operator=(const JSISignalStore&) = delete;
-    
-    // Core signal operations exposed to JSI
-    std::string createSignal(const SignalValue& initialValue);
-    SignalValue getSignal(const std::string& signalId);
-    void setSignal(const std::string& signalId, const SignalValue& value);
-    bool hasSignal(const std::string& signalId);
-    void deleteSignal(const std::string& signalId);
-    uint64_t getSignalVersion(const std::string& signalId);
-    
-    // Batch operations for performance
-    void batchUpdate(const std::vector<std::pair<std::string, SignalValue>>& updates);
-    
-    // Memory management
-    size_t getSignalCount() const;
-    void clear();
+    explicit TypedSignalHostObject(std::shared_ptr<TypedSignal<T>> signal)
+        : signal_(std::move(signal)) {}
+
+    jsi::Value get(jsi::Runtime& rt, const jsi::PropNameID& propName) override {
+        std::string name = propName.utf8(rt);
+        if (name == "value") {
+            return signal_->read([&](const T& value) { return TypedJSI<T>::toJSI(rt, value); });
+        }
+        if (name == "version") {
+            return jsi::Value(static_cast<double>(signal_->getVersion()));
+        }
+        return jsi::Value::undefined();
+    }
+
+    void set(jsi::Runtime& rt, const jsi::PropNameID& propName, const jsi::Value& value) override {
+        if (propName.utf8(rt) != "value") {
+            throw jsi::JSError(rt, "Signal object only supports assigning 'value'");
+        }
+        signal_->set(TypedJSI<T>::fromJSI(rt, value));
+    }
+
+    std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& rt) override {
+        std::vector<jsi::PropNameID> names;
+        names.push_back(jsi::PropNameID::forAscii(rt, "value"));
+        names.push_back(jsi::PropNameID::forAscii(rt, "version"));
+        return names;
+    }
 
 private:
-    JSISignalStore();
-    ~JSISignalStore() = default;
-    
-    mutable std::mutex storeMutex_;  // Protects signals_ map
-    std::unordered_map<std::string, std::shared_ptr<Signal>> signals_;
-    std::atomic<uint64_t> nextSignalId_;
-    
-    std::string generateSignalId();
+    std::shared_ptr<TypedSignal<T>> signal_;
 };
 
 /**
  * Install JSI bindings into the React Native runtime
  * Exposes native functions to JavaScript:
  * - global.__signalForgeCreateSignal
+ * - global.__signalForgeCreateHandle
  * - global.__signalForgeGetSignal
+ * - global.__signalForgeGetMany
+ * - global.__signalForgeGetManyInto
  * - global.__signalForgeSetSignal
  * - global.__signalForgeHasSignal
  * - global.__signalForgeDeleteSignal
  * - global.__signalForgeGetVersion
+ * - global.__signalForgeGetVersionBuffer (+ __signalForgeVersionChunkShift)
+ * - global.__signalForgeCreateNumericSignal
+ * - global.__signalForgeSetNumber
+ * - global.__signalForgeAdd / __signalForgeIncrement / __signalForgeMin /
+ *   __signalForgeMax (atomic numeric read-modify-write)
+ * - global.__signalForgeCompareAndSet
+ * - global.__signalForgeGetNumericBuffer (+ __signalForgeNumericChunkShift)
+ * - global.__signalForgeCreateComputed
  * - global.__signalForgeBatchUpdate
+ * - global.__signalForgeCreateSignalObject
+ * - global.__signalForgeGetSignalObject
+ * - global.__signalForgeGetPoolStats
+ * - global.__signalForgeSubscribe / __signalForgeUnsubscribe (only with a
+ *   jsInvoker: native-thread writes are delivered through it)
+ *
+ * Every function taking a signal ID also accepts a numeric handle.
+ * Signal objects are jsi::HostObjects bound to one Signal: reading or
+ * writing their `value` and `version` properties goes straight to the
+ * Signal without touching the store lock or resolving an ID. Their
+ * `subscribe` delivers like __signalForgeSubscribe and throws without a
+ * jsInvoker. JS callbacks belong to the runtime: they only run and are
+ * only released on the JS thread, and are dropped when it is torn down
  */
-void installJSIBindings(jsi::Runtime& runtime);
+void installJSIBindings(jsi::Runtime& runtime,
+                        std::shared_ptr<react::CallInvoker> jsInvoker = nullptr);
 
 } // namespace signalforge
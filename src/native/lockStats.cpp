@@ -0,0 +1,32 @@
+#include "lockStats.h"
+
+namespace signalforge {
+
+namespace detail {
+
+LockSiteCounters lockSiteCounters[static_cast<size_t>(LockSite::Count)];
+
+} // namespace detail
+
+/**
+ * Snapshot the contention counters of one lock site
+ */
+LockStats getLockStats(LockSite site) {
+    const auto& counters = detail::lockSiteCounters[static_cast<size_t>(site)];
+    return {
+        counters.contended.load(std::memory_order_relaxed),
+        counters.waitNanos.load(std::memory_order_relaxed),
+    };
+}
+
+/**
+ * Zero all contention counters (e.g. between benchmark runs)
+ */
+void resetLockStats() {
+    for (auto& counters : detail::lockSiteCounters) {
+        counters.contended.store(0, std::memory_order_relaxed);
+        counters.waitNanos.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace signalforge
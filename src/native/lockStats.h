@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace signalforge {
+
+/**
+ * Lock sites instrumented for contention
+ * Each site is one family of mutexes (all shard locks, all Signal locks,
+ * all slab pool locks, the computed graph lock) so stats stay meaningful
+ * with thousands of locks
+ */
+enum class LockSite : uint8_t {
+    Shard,   // JSISignalStore shard mutexes (slot table lookups)
+    Signal,  // Signal::mutex_ (writers and subscriber list swaps)
+    Pool,    // SlabPool::mutex_ (signal allocation)
+    Graph,   // ComputedGraph::mutex_ (computed signal propagation)
+    Count
+};
+
+struct LockStats {
+    uint64_t contended;  // Acquisitions that had to block
+    uint64_t waitNanos;  // Total time spent blocked
+};
+
+/**
+ * Contention counters for a lock site (process-wide, since last reset)
+ */
+LockStats getLockStats(LockSite site);
+void resetLockStats();
+
+namespace detail {
+
+struct LockSiteCounters {
+    std::atomic<uint64_t> contended{0};
+    std::atomic<uint64_t> waitNanos{0};
+};
+
+extern LockSiteCounters lockSiteCounters[static_cast<size_t>(LockSite::Count)];
+
+} // namespace detail
+
+/**
+ * InstrumentedMutex - std::mutex that records time spent blocked
+ * The uncontended path is a plain try_lock; only an acquisition that has
+ * to wait reads the clock and touches the shared counters, so the
+ * instrumentation costs nothing until there is contention to measure
+ */
+template <LockSite Site>
+class InstrumentedMutex {
+public:
+    InstrumentedMutex() = default;
+    InstrumentedMutex(const InstrumentedMutex&) = delete;
+    InstrumentedMutex& operator=(const InstrumentedMutex&) = delete;
+
+    void lock() {
+        if (mutex_.try_lock()) {
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        mutex_.lock();
+        auto waited = std::chrono::steady_clock::now() - start;
+
+        auto& counters = detail::lockSiteCounters[static_cast<size_t>(Site)];
+        counters.contended.fetch_add(1, std::memory_order_relaxed);
+        counters.waitNanos.fetch_add(
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count()),
+            std::memory_order_relaxed);
+    }
+
+    bool try_lock() { return mutex_.try_lock(); }
+    void unlock() { mutex_.unlock(); }
+
+private:
+    std::mutex mutex_;
+};
+
+} // namespace signalforge
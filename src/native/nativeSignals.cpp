@@ -0,0 +1,91 @@
+#include "nativeSignals.h"
+
+#include <limits>
+#include <stdexcept>
+
+namespace signalforge {
+
+/**
+ * Resolve the signal once; every later write goes through the pointer
+ */
+NativeSignal::NativeSignal(JSISignalStore& store, SignalHandle handle)
+    : store_(&store), handle_(handle), signal_(store.lookupSignal(handle)) {
+    if (!signal_) {
+        throw std::runtime_error("Signal not found: " + JSISignalStore::formatSignalId(handle));
+    }
+    if (signal_->isComputed()) {
+        throw std::runtime_error("Cannot write to a computed signal");
+    }
+}
+
+// ============================================================================
+// NumberSignal
+// ============================================================================
+
+NumberSignal NumberSignal::create(double initialValue, JSISignalStore& store) {
+    return NumberSignal(store, store.createNumericSignal(initialValue));
+}
+
+NumberSignal NumberSignal::attach(SignalHandle handle, JSISignalStore& store) {
+    NumberSignal signal(store, handle);
+    bool number = signal.signal_->readValue([](const SignalValue& value) {
+        return value.getType() == SignalValue::Type::Number;
+    });
+    if (!number) {
+        throw std::invalid_argument("Signal does not hold a number");
+    }
+    return signal;
+}
+
+/**
+ * NaN when the signal currently holds something other than a number
+ */
+double NumberSignal::get() const {
+    return signal_->readValue([](const SignalValue& value) {
+        return value.getType() == SignalValue::Type::Number
+            ? value.asNumber()
+            : std::numeric_limits<double>::quiet_NaN();
+    });
+}
+
+// ============================================================================
+// StringSignal
+// ============================================================================
+
+StringSignal StringSignal::create(std::string_view initialValue, JSISignalStore& store) {
+    return StringSignal(store, store.createSignalHandle(SignalValue(initialValue)));
+}
+
+StringSignal StringSignal::attach(SignalHandle handle, JSISignalStore& store) {
+    StringSignal signal(store, handle);
+    if (signal.signal_->isNumeric()) {
+        throw std::invalid_argument("Numeric signal requires a number value");
+    }
+    return signal;
+}
+
+std::string StringSignal::get() const {
+    return signal_->readValue([](const SignalValue& value) {
+        return value.getType() == SignalValue::Type::String
+            ? std::string(value.asString())
+            : std::string();
+    });
+}
+
+// ============================================================================
+// BufferSignal
+// ============================================================================
+
+BufferSignal BufferSignal::create(const void* data, size_t size, Kind kind, JSISignalStore& store) {
+    return BufferSignal(store, store.createSignalHandle(SignalValue::binary(data, size, kind)));
+}
+
+BufferSignal BufferSignal::attach(SignalHandle handle, JSISignalStore& store) {
+    BufferSignal signal(store, handle);
+    if (signal.signal_->isNumeric()) {
+        throw std::invalid_argument("Numeric signal requires a number value");
+    }
+    return signal;
+}
+
+} // namespace signalforge
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "signalStore.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace signalforge {
+
+/**
+ * Typed signal handles for other native modules (camera, BLE, audio...)
+ *
+ * A handle resolves its signal once, when it is created or attached, and
+ * keeps it alive: writes go straight to the Signal without string IDs,
+ * slot lookups or generic SignalValue conversion, so producers can feed
+ * UI state at sensor rates. Numbers and short strings (up to
+ * SignalValue::kInlineCapacity bytes) are written without a heap
+ * allocation; buffers can be handed over without a copy
+ *
+ * Handles are cheap to copy and safe to use from any thread. Writes
+ * notify subscribers on the writing thread, as setSignal does; producers
+ * that must not run subscribers should go through a WriteQueue instead
+ *
+ * A handle outlives deletion of its signal from the store: writes still
+ * land on the detached signal but are no longer visible to JS. Check
+ * isAlive() when the signal may be deleted
+ */
+class NativeSignal {
+public:
+    SignalHandle handle() const { return handle_; }
+    std::string id() const { return JSISignalStore::formatSignalId(handle_); }
+    uint64_t version() const { return signal_->getVersion(); }
+    // False once the signal has been deleted from the store
+    bool isAlive() const { return store_->lookupSignal(handle_) == signal_; }
+
+protected:
+    NativeSignal(JSISignalStore& store, SignalHandle handle);
+
+    JSISignalStore* store_;
+    SignalHandle handle_;
+    std::shared_ptr<Signal> signal_;
+};
+
+/**
+ * NumberSignal - numeric signal (backed by the shared numeric buffer)
+ */
+class NumberSignal : public NativeSignal {
+public:
+    static NumberSignal create(double initialValue,
+                               JSISignalStore& store = JSISignalStore::getInstance());
+    // Throws if the signal doesn't exist, is computed or holds a non-number
+    static NumberSignal attach(SignalHandle handle,
+                               JSISignalStore& store = JSISignalStore::getInstance());
+
+    // Returns false (no version bump, no notification) when unchanged
+    bool set(double value) { return signal_->setValue(SignalValue(value)); }
+    double get() const;
+
+    // Atomic read-modify-write, safe against concurrent writers; return
+    // the resulting value. Throw if the signal no longer holds a number
+    double add(double delta) { return signal_->updateNumber(Signal::NumericOp::Add, delta); }
+    double increment() { return add(1.0); }
+    double min(double operand) { return signal_->updateNumber(Signal::NumericOp::Min, operand); }
+    double max(double operand) { return signal_->updateNumber(Signal::NumericOp::Max, operand); }
+    // Write only if version() still equals expectedVersion
+    bool compareAndSet(uint64_t expectedVersion, double value) {
+        return signal_->compareAndSet(expectedVersion, SignalValue(value));
+    }
+
+private:
+    using NativeSignal::NativeSignal;
+};
+
+/**
+ * StringSignal - signal holding a UTF-8 string
+ */
+class StringSignal : public NativeSignal {
+public:
+    static StringSignal create(std::string_view initialValue,
+                               JSISignalStore& store = JSISignalStore::getInstance());
+    // Throws if the signal doesn't exist, is computed or is numeric
+    static StringSignal attach(SignalHandle handle,
+                               JSISignalStore& store = JSISignalStore::getInstance());
+
+    bool set(std::string_view value) { return signal_->setValue(SignalValue(value)); }
+    // Empty when the signal currently holds something other than a string
+    std::string get() const;
+
+private:
+    using NativeSignal::NativeSignal;
+};
+
+/**
+ * BufferSignal - signal holding binary data (ArrayBuffer or typed array)
+ */
+class BufferSignal : public NativeSignal {
+public:
+    using Kind = SignalValue::BinaryKind;
+    using View = SignalValue::BinaryView;
+
+    static BufferSignal create(const void* data, size_t size, Kind kind = Kind::ArrayBuffer,
+                               JSISignalStore& store = JSISignalStore::getInstance());
+    // Throws if the signal doesn't exist, is computed or is numeric
+    static BufferSignal attach(SignalHandle handle,
+                               JSISignalStore& store = JSISignalStore::getInstance());
+
+    // Copy the bytes once
+    bool set(const void* data, size_t size, Kind kind = Kind::ArrayBuffer) {
+        return signal_->setValue(SignalValue::binary(data, size, kind));
+    }
+    // Adopt memory kept alive by owner (no copy); the bytes must not be
+    // modified afterwards, readers on other threads may still see them
+    bool set(std::shared_ptr<void> owner, uint8_t* data, size_t size, Kind kind = Kind::ArrayBuffer) {
+        return signal_->setValue(SignalValue::binary(std::move(owner), data, size, kind));
+    }
+
+    // Inspect the current bytes in place; the view is only valid inside
+    // the visitor, which must not write to this signal. Non-binary values
+    // are visited as an empty view
+    template <typename Visitor>
+    decltype(auto) read(Visitor&& visitor) const {
+        return signal_->readValue([&](const SignalValue& value) -> decltype(auto) {
+            if (value.getType() != SignalValue::Type::Binary) {
+                return visitor(View{nullptr, 0, Kind::ArrayBuffer});
+            }
+            return visitor(value.asBinary());
+        });
+    }
+
+private:
+    using NativeSignal::NativeSignal;
+};
+
+} // namespace signalforge
@@ -0,0 +1,108 @@
+#include "signalPool.h"
+
+namespace signalforge {
+
+/**
+ * Create a pool of blockSize-byte blocks (rounded up to a cache line)
+ * No memory is reserved until the first allocation
+ */
+SlabPool::SlabPool(size_t blockSize, size_t slabBytes)
+    : blockSize_(((blockSize + kCacheLineSize - 1) / kCacheLineSize) * kCacheLineSize),
+      slabBytes_(slabBytes),
+      freeList_(nullptr),
+      freeCount_(0),
+      liveCount_(0),
+      totalAllocations_(0) {
+    if (blockSize_ == 0) {
+        blockSize_ = kCacheLineSize;
+    }
+    if (slabBytes_ < blockSize_) {
+        slabBytes_ = blockSize_;
+    }
+}
+
+/**
+ * Release all slabs
+ * If blocks are still live (objects outliving the pool during static
+ * destruction) the slabs are intentionally leaked instead of freed
+ * under them
+ */
+SlabPool::~SlabPool() {
+    if (liveCount_ != 0) {
+        return;
+    }
+    for (void* slab : slabs_) {
+        ::operator delete(slab, std::align_val_t(kCacheLineSize));
+    }
+}
+
+/**
+ * Reserve one more slab and thread its blocks onto the free list
+ * Caller must hold mutex_
+ */
+void SlabPool::addSlab() {
+    void* slab = ::operator new(slabBytes_, std::align_val_t(kCacheLineSize));
+    slabs_.push_back(slab);
+    
+    auto* bytes = static_cast<unsigned char*>(slab);
+    size_t blocks = slabBytes_ / blockSize_;
+    // Push in reverse so allocations walk the slab front to back
+    for (size_t i = blocks; i-- > 0;) {
+        auto* block = reinterpret_cast<FreeBlock*>(bytes + i * blockSize_);
+        block->next = freeList_;
+        freeList_ = block;
+    }
+    freeCount_ += blocks;
+}
+
+/**
+ * Pop a block from the free list (most recently freed first, which is
+ * usually still warm in cache)
+ */
+void* SlabPool::allocate() {
+    std::lock_guard<Mutex> lock(mutex_);
+    if (!freeList_) {
+        addSlab();
+    }
+    
+    FreeBlock* block = freeList_;
+    freeList_ = block->next;
+    --freeCount_;
+    ++liveCount_;
+    ++totalAllocations_;
+    return block;
+}
+
+/**
+ * Return a block to the free list
+ */
+void SlabPool::deallocate(void* pointer) noexcept {
+    if (!pointer) {
+        return;
+    }
+    
+    std::lock_guard<Mutex> lock(mutex_);
+    auto* block = static_cast<FreeBlock*>(pointer);
+    block->next = freeList_;
+    freeList_ = block;
+    ++freeCount_;
+    --liveCount_;
+}
+
+/**
+ * Snapshot of pool occupancy counters
+ */
+SlabPool::Stats SlabPool::getStats() const {
+    std::lock_guard<Mutex> lock(mutex_);
+    Stats stats;
+    stats.blockSize = blockSize_;
+    stats.blocksPerSlab = slabBytes_ / blockSize_;
+    stats.slabCount = slabs_.size();
+    stats.liveBlocks = liveCount_;
+    stats.freeBlocks = freeCount_;
+    stats.totalAllocations = totalAllocations_;
+    stats.bytesReserved = slabs_.size() * slabBytes_;
+    return stats;
+}
+
+} // namespace signalforge
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "lockStats.h"
+#include "syncPolicy.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace signalforge {
+
+/**
+ * SlabPool - fixed-size block allocator for hot native objects
+ * Blocks are carved out of large slabs and recycled through an intrusive
+ * free list, so creating and destroying thousands of signals per screen
+ * reuses memory instead of going through malloc each time. Block size is
+ * rounded up to a cache line: neighbouring objects never share a line,
+ * so one signal's mutex/atomics don't false-share with the next one's
+ */
+class SlabPool {
+public:
+    static constexpr size_t kCacheLineSize = 64;
+    static constexpr size_t kDefaultSlabBytes = 16 * 1024;
+
+    struct Stats {
+        size_t blockSize;          // Bytes per block (cache-line multiple)
+        size_t blocksPerSlab;
+        size_t slabCount;          // Slabs currently reserved
+        size_t liveBlocks;         // Blocks handed out and not yet returned
+        size_t freeBlocks;         // Reserved blocks ready for reuse
+        size_t totalAllocations;   // Blocks served over the pool's lifetime
+        size_t bytesReserved;      // slabCount * slab size
+    };
+
+    explicit SlabPool(size_t blockSize, size_t slabBytes = kDefaultSlabBytes);
+    ~SlabPool();
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    size_t blockSize() const { return blockSize_; }
+
+    void* allocate();
+    void deallocate(void* block) noexcept;
+
+    Stats getStats() const;
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    using Mutex = SyncPolicy::Mutex<LockSite::Pool>;
+
+    mutable Mutex mutex_;
+    size_t blockSize_;
+    size_t slabBytes_;
+    std::vector<void*> slabs_;
+    FreeBlock* freeList_;
+    size_t freeCount_;
+    size_t liveCount_;
+    size_t totalAllocations_;
+
+    void addSlab();
+};
+
+/**
+ * PoolAllocator - std allocator adapter over a SlabPool
+ * Meant for std::allocate_shared: the control block and object land in a
+ * single pool block. Requests that don't fit one block (arrays, larger
+ * rebound types) fall back to the global heap
+ */
+template <typename T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(SlabPool& pool) noexcept : pool_(&pool) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : pool_(other.pool()) {}
+
+    T* allocate(size_t count) {
+        if (count == 1 && sizeof(T) <= pool_->blockSize() && alignof(T) <= SlabPool::kCacheLineSize) {
+            return static_cast<T*>(pool_->allocate());
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t count) noexcept {
+        if (count == 1 && sizeof(T) <= pool_->blockSize() && alignof(T) <= SlabPool::kCacheLineSize) {
+            pool_->deallocate(pointer);
+        } else {
+            ::operator delete(pointer);
+        }
+    }
+
+    SlabPool* pool() const noexcept { return pool_; }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept { return pool_ == other.pool(); }
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>& other) const noexcept { return pool_ != other.pool(); }
+
+private:
+    SlabPool* pool_;
+};
+
+} // namespace signalforge
@@ -0,0 +1,1366 @@
+#include "signalStore.h"
+#include "computedGraph.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+namespace signalforge {
+
+// ============================================================================
+// SignalValue Implementation
+// ============================================================================
+
+/**
+ * HeapCell - reference count shared by every out-of-line payload
+ * The owning SignalValue's type_ identifies the concrete cell type
+ */
+struct SignalValue::HeapCell {
+    SyncPolicy::Atomic<uint32_t> refCount{1};
+    mutable SyncPolicy::Atomic<uint64_t> cachedHash{0};  // 0 = not computed yet
+};
+
+/**
+ * HeapString - immutable, reference-counted storage for strings longer than
+ * kInlineCapacity. Characters are allocated in the same block as the header,
+ * so a long string costs exactly one allocation and copies only bump refCount
+ */
+struct SignalValue::HeapString : HeapCell {
+    size_t size = 0;
+
+    const char* data() const { return reinterpret_cast<const char*>(this + 1); }
+    char* data() { return reinterpret_cast<char*>(this + 1); }
+
+    static HeapString* create(std::string_view text) {
+        void* memory = ::operator new(sizeof(HeapString) + text.size());
+        auto* heapString = new (memory) HeapString();
+        heapString->size = text.size();
+        std::memcpy(heapString->data(), text.data(), text.size());
+        return heapString;
+    }
+
+    static void destroy(HeapString* heapString) {
+        heapString->~HeapString();
+        ::operator delete(heapString);
+    }
+};
+
+/**
+ * HeapObject / HeapArray - immutable structured payloads
+ * Children are SignalValues themselves, so nested long strings and
+ * sub-trees are shared rather than copied
+ */
+struct SignalValue::HeapObject : HeapCell {
+    ObjectEntries entries;
+};
+
+struct SignalValue::HeapArray : HeapCell {
+    ArrayElements elements;
+};
+
+/**
+ * HeapBinary - native byte buffer
+ * Copied bytes are allocated in the same block as the header; adopted
+ * memory is kept alive by owner until the last SignalValue (or JS
+ * ArrayBuffer view) lets go of the cell
+ */
+struct SignalValue::HeapBinary : HeapCell {
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    BinaryKind kind = BinaryKind::ArrayBuffer;
+    std::shared_ptr<void> owner;
+
+    static HeapBinary* create(const void* bytes, size_t size, BinaryKind kind) {
+        void* memory = ::operator new(sizeof(HeapBinary) + size);
+        auto* cell = new (memory) HeapBinary();
+        cell->data = reinterpret_cast<uint8_t*>(cell + 1);
+        cell->size = size;
+        cell->kind = kind;
+        if (size > 0) {
+            std::memcpy(cell->data, bytes, size);
+        }
+        return cell;
+    }
+
+    static void destroy(HeapBinary* cell) {
+        cell->~HeapBinary();
+        ::operator delete(cell);
+    }
+};
+
+/**
+ * Default constructor - creates an undefined value
+ */
+SignalValue::SignalValue() noexcept
+    : storage_{}, inlineSize_(0), type_(Type::Undefined) {}
+
+/**
+ * Boolean constructor - stores primitive boolean value inline
+ */
+SignalValue::SignalValue(bool value) noexcept
+    : storage_{}, inlineSize_(0), type_(Type::Boolean) {
+    storage_[0] = value ? 1 : 0;
+}
+
+/**
+ * Number constructor - stores primitive numeric value inline
+ */
+SignalValue::SignalValue(double value) noexcept
+    : storage_{}, inlineSize_(0), type_(Type::Number) {
+    std::memcpy(storage_, &value, sizeof(double));
+}
+
+/**
+ * String constructors - short strings inline, long strings out of line
+ */
+SignalValue::SignalValue(const char* value)
+    : SignalValue(Type::String, std::string_view(value)) {}
+
+SignalValue::SignalValue(const std::string& value)
+    : SignalValue(Type::String, std::string_view(value)) {}
+
+SignalValue::SignalValue(std::string_view value)
+    : SignalValue(Type::String, value) {}
+
+/**
+ * Text constructor for String values
+ */
+SignalValue::SignalValue(Type type, std::string_view text)
+    : storage_{}, inlineSize_(0), type_(type) {
+    if (text.size() <= kInlineCapacity) {
+        std::memcpy(storage_, text.data(), text.size());
+        inlineSize_ = static_cast<uint8_t>(text.size());
+    } else {
+        HeapString* heapString = HeapString::create(text);
+        std::memcpy(storage_, &heapString, sizeof(heapString));
+        inlineSize_ = kHeapMarker;
+    }
+}
+
+/**
+ * Adopt an already-referenced heap cell (refCount starts at 1)
+ */
+SignalValue::SignalValue(Type type, HeapCell* cell) noexcept
+    : storage_{}, inlineSize_(kHeapMarker), type_(type) {
+    std::memcpy(storage_, &cell, sizeof(cell));
+}
+
+/**
+ * Null value (distinct from the default undefined)
+ */
+SignalValue SignalValue::null() noexcept {
+    SignalValue value;
+    value.type_ = Type::Null;
+    return value;
+}
+
+/**
+ * Build an object value from key/value entries
+ */
+SignalValue SignalValue::object(ObjectEntries entries) {
+    auto* cell = new HeapObject();
+    cell->entries = std::move(entries);
+    return SignalValue(Type::Object, cell);
+}
+
+/**
+ * Build an array value from elements
+ */
+SignalValue SignalValue::array(ArrayElements elements) {
+    auto* cell = new HeapArray();
+    cell->elements = std::move(elements);
+    return SignalValue(Type::Array, cell);
+}
+
+/**
+ * Build a binary value by copying bytes into native memory
+ */
+SignalValue SignalValue::binary(const void* data, size_t size, BinaryKind kind) {
+    return SignalValue(Type::Binary, HeapBinary::create(data, size, kind));
+}
+
+/**
+ * Build a binary value over existing memory without copying
+ * owner must keep data valid; it is released with the last reference
+ */
+SignalValue SignalValue::binary(std::shared_ptr<void> owner, uint8_t* data, size_t size,
+                                BinaryKind kind) {
+    auto* cell = new HeapBinary();
+    cell->data = data;
+    cell->size = size;
+    cell->kind = kind;
+    cell->owner = std::move(owner);
+    return SignalValue(Type::Binary, cell);
+}
+SignalValue::HeapCell* SignalValue::heap() const {
+    HeapCell* cell;
+    std::memcpy(&cell, storage_, sizeof(cell));
+    return cell;
+}
+
+/**
+ * Share out-of-line storage with a new copy (relaxed: the creator already
+ * published the contents before the value became reachable)
+ */
+void SignalValue::retain() const noexcept {
+    if (isHeap()) {
+        heap()->refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Drop this value's reference; the last owner frees the payload
+ */
+void SignalValue::release() noexcept {
+    if (isHeap()) {
+        HeapCell* cell = heap();
+        if (cell->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            switch (type_) {
+                case Type::String:
+                    HeapString::destroy(static_cast<HeapString*>(cell));
+                    break;
+                case Type::Object:
+                    delete static_cast<HeapObject*>(cell);
+                    break;
+                case Type::Array:
+                    delete static_cast<HeapArray*>(cell);
+                    break;
+                case Type::Binary:
+                    HeapBinary::destroy(static_cast<HeapBinary*>(cell));
+                    break;
+                default:
+                    break;
+            }
+        }
+        inlineSize_ = 0;
+    }
+}
+
+bool SignalValue::asBoolean() const {
+    return type_ == Type::Boolean && storage_[0] != 0;
+}
+
+double SignalValue::asNumber() const {
+    if (type_ != Type::Number) {
+        return 0.0;
+    }
+    double value;
+    std::memcpy(&value, storage_, sizeof(double));
+    return value;
+}
+
+/**
+ * View of String text; valid while this value is alive
+ */
+std::string_view SignalValue::asString() const {
+    if (type_ != Type::String) {
+        return {};
+    }
+    if (isHeap()) {
+        const auto* heapString = static_cast<const HeapString*>(heap());
+        return std::string_view(heapString->data(), heapString->size);
+    }
+    return std::string_view(reinterpret_cast<const char*>(storage_), inlineSize_);
+}
+
+/**
+ * Object entries (empty for non-objects)
+ */
+const SignalValue::ObjectEntries& SignalValue::asObject() const {
+    static const ObjectEntries empty;
+    if (type_ != Type::Object) {
+        return empty;
+    }
+    return static_cast<const HeapObject*>(heap())->entries;
+}
+
+/**
+ * Array elements (empty for non-arrays)
+ */
+const SignalValue::ArrayElements& SignalValue::asArray() const {
+    static const ArrayElements empty;
+    if (type_ != Type::Array) {
+        return empty;
+    }
+    return static_cast<const HeapArray*>(heap())->elements;
+}
+
+/**
+ * Binary bytes and view type (empty for non-binary values)
+ */
+SignalValue::BinaryView SignalValue::asBinary() const {
+    if (type_ != Type::Binary) {
+        return {nullptr, 0, BinaryKind::ArrayBuffer};
+    }
+    const auto* cell = static_cast<const HeapBinary*>(heap());
+    return {cell->data, cell->size, cell->kind};
+}
+
+namespace {
+
+constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+uint64_t hashBytes(const void* data, size_t size, uint64_t seed = kFnvOffset) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * kFnvPrime;
+    }
+    return hash;
+}
+
+uint64_t combineHash(uint64_t seed, uint64_t value) {
+    return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+/**
+ * Object.is for numbers: NaN is equal to itself, +0 and -0 differ
+ */
+bool sameNumber(double a, double b) {
+    if (a != a) {
+        return b != b;
+    }
+    if (a == 0.0 && b == 0.0) {
+        return std::signbit(a) == std::signbit(b);
+    }
+    return a == b;
+}
+
+} // namespace
+
+/**
+ * Deep equality - see header for semantics
+ */
+bool SignalValue::operator==(const SignalValue& other) const {
+    if (type_ != other.type_) {
+        return false;
+    }
+    
+    switch (type_) {
+        case Type::Undefined:
+        case Type::Null:
+            return true;
+        case Type::Boolean:
+            return asBoolean() == other.asBoolean();
+        case Type::Number:
+            return sameNumber(asNumber(), other.asNumber());
+        default:
+            break;
+    }
+    
+    if (isHeap() && other.isHeap()) {
+        // Same shared payload (e.g. re-setting a value read from the signal)
+        if (heap() == other.heap()) {
+            return true;
+        }
+        // Cheap rejection when both hashes are already known
+        uint64_t hashA = heap()->cachedHash.load(std::memory_order_relaxed);
+        uint64_t hashB = other.heap()->cachedHash.load(std::memory_order_relaxed);
+        if (hashA != 0 && hashB != 0 && hashA != hashB) {
+            return false;
+        }
+    }
+    
+    switch (type_) {
+        case Type::String:
+            return asString() == other.asString();
+        case Type::Object: {
+            const ObjectEntries& a = asObject();
+            const ObjectEntries& b = other.asObject();
+            if (a.size() != b.size() || hash() != other.hash()) {
+                return false;
+            }
+            for (size_t i = 0; i < a.size(); ++i) {
+                if (a[i].first != b[i].first || a[i].second != b[i].second) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case Type::Array: {
+            const ArrayElements& a = asArray();
+            const ArrayElements& b = other.asArray();
+            if (a.size() != b.size() || hash() != other.hash()) {
+                return false;
+            }
+            for (size_t i = 0; i < a.size(); ++i) {
+                if (a[i] != b[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case Type::Binary:
+            // Identity only (the same payload matched above): the bytes
+            // are shared with JS, which may write to them at any time
+            return false;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Content hash - computed once per heap payload and cached
+ * Object key order is significant, matching operator==
+ */
+uint64_t SignalValue::hash() const {
+    uint64_t cached = 0;
+    if (isHeap()) {
+        cached = heap()->cachedHash.load(std::memory_order_relaxed);
+        if (cached != 0) {
+            return cached;
+        }
+    }
+    
+    uint64_t result = combineHash(kFnvOffset, static_cast<uint64_t>(type_));
+    switch (type_) {
+        case Type::Boolean:
+            result = combineHash(result, asBoolean() ? 1 : 0);
+            break;
+        case Type::Number: {
+            double number = asNumber();
+            if (number != number) {
+                number = std::numeric_limits<double>::quiet_NaN();  // One hash for all NaNs
+            }
+            result = hashBytes(&number, sizeof(number), result);
+            break;
+        }
+        case Type::String: {
+            std::string_view text = asString();
+            result = hashBytes(text.data(), text.size(), result);
+            break;
+        }
+        case Type::Object:
+            for (const auto& [name, value] : asObject()) {
+                result = hashBytes(name.data(), name.size(), result);
+                result = combineHash(result, value.hash());
+            }
+            break;
+        case Type::Array:
+            for (const auto& element : asArray()) {
+                result = combineHash(result, element.hash());
+            }
+            break;
+        case Type::Binary:
+            // Identity, matching operator==; never reads the mutable bytes
+            result = combineHash(result, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(heap())));
+            break;
+        default:
+            break;
+    }
+    
+    if (result == 0) {
+        result = 1;  // Reserve 0 for "not computed"
+    }
+    if (isHeap()) {
+        heap()->cachedHash.store(result, std::memory_order_relaxed);
+    }
+    return result;
+}
+
+/**
+ * Look up an object property by key; nullptr when absent
+ */
+const SignalValue* SignalValue::getProperty(std::string_view key) const {
+    for (const auto& [name, value] : asObject()) {
+        if (name == key) {
+            return &value;
+        }
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// Signal Implementation
+// ============================================================================
+
+/**
+ * Signal constructor - initializes with a value and version 0
+ * version_ is atomic for lock-free reads in change detection
+ */
+Signal::Signal(const SignalValue& initialValue)
+    : current_(new ValueNode{initialValue}),
+      activeReaders_{},
+      readEpoch_(0),
+      retired_(nullptr),
+      draining_(nullptr),
+      retiredCount_(0),
+      version_(0),
+      subscribers_(std::make_shared<const SubscriberList>()),
+      nextSubscriberId_(0),
+      versionCounter_(nullptr),
+      numeric_(false),
+      numericCell_(nullptr),
+      numericCellIndex_(0) {}
+
+/**
+ * Destructor - no readers can remain once the last owner lets go
+ */
+Signal::~Signal() {
+    delete current_.load(std::memory_order_relaxed);
+    freeNodes(retired_);
+    freeNodes(draining_);
+}
+
+/**
+ * Lock-free getValue - copies the current snapshot
+ * Copies are cheap: numbers and short strings are inline, long strings,
+ * objects and buffers only bump a reference count
+ */
+SignalValue Signal::getValue() const {
+    return readValue([](const SignalValue& value) { return value; });
+}
+
+SignalValue Signal::loadValue() const {
+    ReadSection section(*this);
+    return current_.load(std::memory_order_seq_cst)->value;
+}
+
+/**
+ * Recompute a stale computed signal before it is read
+ * Clean reads only pay for one atomic load
+ */
+void Signal::refreshComputed() const {
+    if (computed_->stale.load(std::memory_order_acquire)) {
+        computed_->graph.refresh(*computed_);
+    }
+}
+
+/**
+ * Swap in a new snapshot and retire the previous one
+ * Caller must hold mutex_
+ */
+void Signal::publish(const SignalValue& newValue) {
+    auto* node = new ValueNode{newValue};
+    ValueNode* previous = current_.exchange(node, std::memory_order_seq_cst);
+    previous->nextRetired = retired_;
+    retired_ = previous;
+    retiredCount_++;
+    reclaimRetired();
+    
+    // Blocking fallback: a reader stalled inside a read section (preempted,
+    // slow visitor) holds back reclamation; wait for it rather than let the
+    // list grow. Only reads older than the retired snapshots are waited on
+    if constexpr (SyncPolicy::kThreadSafe) {
+        while (retiredCount_ >= kMaxRetired) {
+            std::this_thread::yield();
+            reclaimRetired();
+        }
+    }
+}
+
+/**
+ * Free retired snapshots whose readers have all left
+ * A reader registers before loading current_, so a snapshot can be freed
+ * once each epoch's counter has been seen at zero after it was replaced.
+ * The counter new readers are not entering is checked first: when it is
+ * zero, draining_ (already checked against the other counter before the
+ * last flip) is freed, retired_ becomes draining_ and the epoch flips so
+ * the busy counter drains next. A quiet moment frees everything at once
+ * Caller must hold mutex_
+ */
+void Signal::reclaimRetired() {
+    uint32_t epoch = readEpoch_.load(std::memory_order_relaxed);
+    if (activeReaders_[epoch ^ 1].load(std::memory_order_seq_cst) != 0) {
+        return;
+    }
+    retiredCount_ -= freeNodes(draining_);
+    if (activeReaders_[epoch].load(std::memory_order_seq_cst) == 0) {
+        retiredCount_ -= freeNodes(retired_);
+        return;
+    }
+    draining_ = retired_;
+    retired_ = nullptr;
+    readEpoch_.store(epoch ^ 1, std::memory_order_seq_cst);
+}
+
+size_t Signal::freeNodes(ValueNode*& list) {
+    size_t freed = 0;
+    while (list) {
+        ValueNode* next = list->nextRetired;
+        delete list;
+        list = next;
+        freed++;
+    }
+    return freed;
+}
+
+/**
+ * Apply a write: publish the value and increments version atomically
+ * Unchanged writes (SignalValue equality) stop here: no snapshot, no
+ * version bump, and nullptr tells the caller not to notify
+ * Caller must hold mutex_
+ */
+std::shared_ptr<const Signal::SubscriberList> Signal::commit(const SignalValue& newValue) {
+    if (current_.load(std::memory_order_relaxed)->value == newValue) {
+        return nullptr;
+    }
+    publish(newValue);
+    if (numericCell_) {
+        numericCell_->store(newValue.asNumber(), std::memory_order_release);
+    }
+    // Atomic increment ensures version is always consistent
+    // memory_order_release ensures write is visible to other threads
+    version_.fetch_add(1, std::memory_order_release);
+    if (versionCounter_) {
+        versionCounter_->fetch_add(1, std::memory_order_release);
+    }
+    
+    // The subscriber snapshot is shared, not copied: (un)subscribe replaces
+    // the list instead of mutating it, so holding a reference is race-free
+    return subscribers_;
+}
+
+/**
+ * Run callbacks for one committed write
+ * Must be called without holding mutex_ to prevent deadlocks
+ */
+void Signal::notify(const SubscriberList& subscribers, const SignalValue& value) {
+    for (const auto& [id, callback] : subscribers) {
+        try {
+            callback(value);
+        } catch (...) {
+            // Swallow exceptions to prevent one subscriber from breaking others
+        }
+    }
+}
+
+/**
+ * Thread-safe setValue - commits the value and notifies subscribers
+ * The version bump allows React components to detect changes without locking
+ * Returns false when the value was unchanged
+ */
+bool Signal::setValue(const SignalValue& newValue) {
+    if (numeric_ && newValue.getType() != SignalValue::Type::Number) {
+        throw std::invalid_argument("Numeric signal requires a number value");
+    }
+    if (computed_) {
+        throw std::runtime_error("Cannot write to a computed signal");
+    }
+    
+    std::shared_ptr<const SubscriberList> subscribers;
+    
+    {
+        std::lock_guard<Mutex> lock(mutex_);
+        subscribers = commit(newValue);
+    }
+    
+    if (!subscribers) {
+        return false;
+    }
+    
+    // Execute callbacks outside the lock to prevent deadlocks
+    notify(*subscribers, newValue);
+    return true;
+}
+
+namespace {
+
+/**
+ * JS Math.min / Math.max: NaN if either side is NaN, -0 below +0
+ */
+double applyNumericOp(Signal::NumericOp op, double current, double operand) {
+    if (op == Signal::NumericOp::Add) {
+        return current + operand;
+    }
+    if (std::isnan(current) || std::isnan(operand)) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    bool takeOperand;
+    if (current == operand) {
+        // Only differs for zeros: Min prefers -0, Max prefers +0
+        takeOperand = (op == Signal::NumericOp::Min) == std::signbit(operand);
+    } else {
+        takeOperand = (op == Signal::NumericOp::Min) == (operand < current);
+    }
+    return takeOperand ? operand : current;
+}
+
+} // namespace
+
+/**
+ * Read-modify-write under mutex_: no write can land between the read and
+ * the commit, so the type check and the update see the same value.
+ * Unchanged results (e.g. min with a larger operand) don't bump the version
+ */
+double Signal::updateNumber(NumericOp op, double operand) {
+    if (computed_) {
+        throw std::runtime_error("Cannot write to a computed signal");
+    }
+    
+    std::shared_ptr<const SubscriberList> subscribers;
+    SignalValue result;
+    
+    {
+        std::lock_guard<Mutex> lock(mutex_);
+        const SignalValue& value = current_.load(std::memory_order_relaxed)->value;
+        if (value.getType() != SignalValue::Type::Number) {
+            throw std::invalid_argument("Atomic numeric operations require a number value");
+        }
+        double current = value.asNumber();
+        result = SignalValue(applyNumericOp(op, current, operand));
+        subscribers = commit(result);
+    }
+    
+    if (subscribers) {
+        notify(*subscribers, result);
+    }
+    return result.asNumber();
+}
+
+/**
+ * Versioned write: the version check and the commit share one critical
+ * section. An unchanged value still succeeds (without a version bump)
+ */
+bool Signal::compareAndSet(uint64_t expectedVersion, const SignalValue& newValue) {
+    if (numeric_ && newValue.getType() != SignalValue::Type::Number) {
+        throw std::invalid_argument("Numeric signal requires a number value");
+    }
+    if (computed_) {
+        throw std::runtime_error("Cannot write to a computed signal");
+    }
+    
+    std::shared_ptr<const SubscriberList> subscribers;
+    
+    {
+        std::lock_guard<Mutex> lock(mutex_);
+        if (version_.load(std::memory_order_relaxed) != expectedVersion) {
+            return false;
+        }
+        subscribers = commit(newValue);
+    }
+    
+    if (subscribers) {
+        notify(*subscribers, newValue);
+    }
+    return true;
+}
+
+/**
+ * Subscribe to signal changes - returns unique subscription ID
+ * Callbacks are executed when signal value changes
+ * Copies the list once per subscribe so writes never have to
+ * A computed signal is brought up to date first: from then on it is
+ * recomputed eagerly, and callbacks only see changes after subscribing
+ */
+size_t Signal::subscribe(Callback callback) {
+    if (computed_) {
+        refreshComputed();
+    }
+    std::lock_guard<Mutex> lock(mutex_);
+    size_t id = nextSubscriberId_++;
+    
+    auto next = std::make_shared<SubscriberList>();
+    next->reserve(subscribers_->size() + 1);
+    *next = *subscribers_;
+    next->emplace_back(id, std::move(callback));
+    subscribers_ = std::move(next);
+    return id;
+}
+
+/**
+ * Unsubscribe - removes callback using subscription ID
+ * Notifications already in flight finish with the list they started with
+ */
+void Signal::unsubscribe(size_t id) {
+    std::lock_guard<Mutex> lock(mutex_);
+    
+    auto next = std::make_shared<SubscriberList>();
+    next->reserve(subscribers_->size());
+    for (const auto& entry : *subscribers_) {
+        if (entry.first != id) {
+            next->push_back(entry);
+        }
+    }
+    if (next->size() != subscribers_->size()) {
+        subscribers_ = std::move(next);
+    }
+}
+
+/**
+ * Number of active subscriptions
+ */
+size_t Signal::getSubscriberCount() const {
+    std::lock_guard<Mutex> lock(mutex_);
+    return subscribers_->size();
+}
+
+// ============================================================================
+// JSISignalStore Implementation
+// ============================================================================
+
+namespace {
+
+/**
+ * Advance a slot generation, wrapping within the JS-safe bit range
+ * Generation 0 is skipped so default-constructed handles never match
+ */
+uint32_t nextGeneration(uint32_t generation) {
+    uint32_t next = (generation + 1) & SignalHandle::kGenerationMask;
+    return next == 0 ? 1 : next;
+}
+
+} // namespace
+
+/**
+ * Thread-safe singleton instance using Meyer's Singleton pattern
+ * Guaranteed to be initialized exactly once in a thread-safe manner
+ */
+JSISignalStore& JSISignalStore::getInstance() {
+    static JSISignalStore instance;
+    return instance;
+}
+
+/**
+ * Private constructor - starts with an empty slot table
+ */
+JSISignalStore::JSISignalStore()
+    : nextNumericCell_(0),
+      computedGraph_(std::make_unique<ComputedGraph>()),
+      nextShard_(0),
+      signalCount_(0) {
+    signalPools_.reserve(kPoolCount);
+    for (uint32_t i = 0; i < kPoolCount; ++i) {
+        signalPools_.push_back(std::make_unique<SlabPool>(kSignalBlockSize));
+    }
+}
+
+JSISignalStore::~JSISignalStore() = default;
+
+/**
+ * Format a handle as a string ID: "sig_<handle bits>"
+ */
+std::string JSISignalStore::formatSignalId(SignalHandle handle) {
+    return "sig_" + std::to_string(handle.toBits());
+}
+
+/**
+ * Parse a string ID back into its handle
+ * Returns an invalid handle for strings this store never issued
+ */
+SignalHandle JSISignalStore::parseSignalId(const std::string& signalId) {
+    constexpr size_t kPrefixLength = 4;
+    if (signalId.size() <= kPrefixLength || signalId.compare(0, kPrefixLength, "sig_") != 0) {
+        return SignalHandle();
+    }
+    
+    uint64_t bits = 0;
+    for (size_t i = kPrefixLength; i < signalId.size(); ++i) {
+        char c = signalId[i];
+        if (c < '0' || c > '9' || bits > (UINT64_MAX - 9) / 10) {
+            return SignalHandle();
+        }
+        bits = bits * 10 + static_cast<uint64_t>(c - '0');
+    }
+    
+    SignalHandle handle = SignalHandle::fromBits(bits);
+    return handle.toBits() == bits ? handle : SignalHandle();
+}
+
+/**
+ * Resolve a handle to its signal (nullptr when stale or unknown)
+ * Locks only the shard that owns the slot
+ */
+std::shared_ptr<Signal> JSISignalStore::findSignal(SignalHandle handle) const {
+    const Shard& shard = shards_[handle.slot & (kShardCount - 1)];
+    uint32_t local = handle.slot >> kShardBits;
+    
+    std::lock_guard<ShardMutex> lock(shard.mutex);
+    if (local >= shard.slots.size()) {
+        return nullptr;
+    }
+    const SignalSlot& slot = shard.slots[local];
+    if (slot.generation != handle.generation || !slot.signal) {
+        return nullptr;
+    }
+    return slot.signal;  // Increment ref count
+}
+
+/**
+ * Resolve a handle or throw if the signal doesn't exist
+ */
+std::shared_ptr<Signal> JSISignalStore::requireSignal(SignalHandle handle) const {
+    std::shared_ptr<Signal> signal = findSignal(handle);
+    if (!signal) {
+        throw std::runtime_error("Signal not found: " + formatSignalId(handle));
+    }
+    return signal;
+}
+
+/**
+ * Create a new signal with initial value
+ * Returns unique signal ID for future operations
+ */
+std::string JSISignalStore::createSignal(const SignalValue& initialValue) {
+    return formatSignalId(createSignalHandle(initialValue));
+}
+
+/**
+ * Create a new signal and return its handle
+ * Reuses freed slots first so each shard stays dense
+ * Thread-safe: locks only the chosen shard
+ */
+SignalHandle JSISignalStore::createSignalHandle(const SignalValue& initialValue) {
+    return addSignal(initialValue, false);
+}
+
+/**
+ * Create a numeric signal; its value also lives in a numeric buffer cell
+ */
+SignalHandle JSISignalStore::createNumericSignal(double initialValue) {
+    return addSignal(SignalValue(initialValue), true);
+}
+
+/**
+ * Create a computed signal over existing signals
+ * The node is attached before the signal is published and linked (which
+ * computes the first value) right after, so the handle never reads an
+ * uncomputed value
+ */
+SignalHandle JSISignalStore::createComputed(const std::vector<SignalHandle>& dependencies,
+                                            ComputeFunction compute) {
+    if (!compute) {
+        throw std::invalid_argument("Computed signal requires a compute function");
+    }
+    std::vector<std::shared_ptr<Signal>> inputs;
+    inputs.reserve(dependencies.size());
+    for (SignalHandle dependency : dependencies) {
+        inputs.push_back(requireSignal(dependency));
+    }
+    
+    auto node = std::make_shared<ComputedNode>(*computedGraph_, std::move(inputs), std::move(compute));
+    SignalHandle handle = addSignal(SignalValue(), false, node);
+    try {
+        computedGraph_->link(*node);
+    } catch (...) {
+        deleteSignal(handle);
+        throw;
+    }
+    return handle;
+}
+
+/**
+ * Numeric buffer cell of a live numeric signal
+ */
+int64_t JSISignalStore::getNumericCell(SignalHandle handle) {
+    std::shared_ptr<Signal> signal = findSignal(handle);
+    if (!signal || !signal->numeric_) {
+        return -1;
+    }
+    return signal->numericCellIndex_;
+}
+
+/**
+ * Allocate a signal and place it in the next shard (round-robin)
+ */
+SignalHandle JSISignalStore::addSignal(const SignalValue& initialValue, bool numeric,
+                                       std::shared_ptr<ComputedNode> computed) {
+    uint32_t shardIndex = nextShard_.fetch_add(1, std::memory_order_relaxed) & (kShardCount - 1);
+    Shard& shard = shards_[shardIndex];
+    
+    // Use shared_ptr for automatic memory management
+    // Multiple owners can hold references safely; the Signal and its
+    // control block share one pooled block
+    SlabPool& pool = *signalPools_[shardIndex & (kPoolCount - 1)];
+    auto signal = std::allocate_shared<Signal>(PoolAllocator<Signal>(pool), initialValue);
+    
+    uint32_t cellIndex = 0;
+    if (numeric) {
+        std::lock_guard<SyncPolicy::PlainMutex> lock(numericCellMutex_);
+        if (!freeNumericCells_.empty()) {
+            cellIndex = freeNumericCells_.back();
+            freeNumericCells_.pop_back();
+        } else {
+            if (nextNumericCell_ >= NumericBuffer::kCapacity) {
+                throw std::runtime_error("Numeric signal buffer is full");
+            }
+            cellIndex = nextNumericCell_++;
+        }
+    }
+    
+    SignalHandle handle;
+    try {
+        if (numeric) {
+            signal->numeric_ = true;
+            signal->numericCellIndex_ = cellIndex;
+            signal->numericCell_ = numbers_.at(cellIndex);
+            signal->numericCell_->store(initialValue.asNumber(), std::memory_order_release);
+        }
+        if (computed) {
+            computed->signal = signal.get();
+            signal->computed_ = std::move(computed);
+        }
+        
+        std::lock_guard<ShardMutex> lock(shard.mutex);
+        
+        uint32_t local;
+        if (!shard.freeSlots.empty()) {
+            local = shard.freeSlots.back();
+            shard.freeSlots.pop_back();
+        } else {
+            if (shard.slots.size() > (UINT32_MAX >> kShardBits)) {
+                throw std::runtime_error("Signal slot table is full");
+            }
+            local = static_cast<uint32_t>(shard.slots.size());
+            shard.slots.emplace_back();
+        }
+        
+        handle.slot = (local << kShardBits) | shardIndex;
+        
+        // A reused slot keeps counting from where the old signal left off
+        signal->versionCounter_ = versions_.at(handle.slot);
+        
+        SignalSlot& slot = shard.slots[local];
+        slot.signal = std::move(signal);
+        handle.generation = slot.generation;
+    } catch (...) {
+        // The signal never became reachable: give its numeric cell back
+        if (numeric) {
+            std::lock_guard<SyncPolicy::PlainMutex> lock(numericCellMutex_);
+            freeNumericCells_.push_back(cellIndex);
+        }
+        throw;
+    }
+    
+    signalCount_.fetch_add(1, std::memory_order_relaxed);
+    return handle;
+}
+
+/**
+ * Get current value of a signal by ID
+ * Throws if signal doesn't exist
+ */
+SignalValue JSISignalStore::getSignal(const std::string& signalId) {
+    return getSignal(parseSignalId(signalId));
+}
+
+SignalValue JSISignalStore::getSignal(SignalHandle handle) {
+    // Access signal outside the store lock
+    return requireSignal(handle)->getValue();
+}
+
+/**
+ * Update signal value by ID
+ * Throws if signal doesn't exist
+ * The version bump happens inside Signal::setValue
+ */
+void JSISignalStore::setSignal(const std::string& signalId, const SignalValue& value) {
+    setSignal(parseSignalId(signalId), value);
+}
+
+void JSISignalStore::setSignal(SignalHandle handle, const SignalValue& value) {
+    // Update signal outside the store lock
+    requireSignal(handle)->setValue(value);
+}
+
+/**
+ * Read many signals in one pass
+ * Handles are bucketed by shard (counting sort) so every shard is locked
+ * once no matter how the handles interleave; values are read lock-free
+ * under the shard lock, so no shared_ptr is copied per signal
+ */
+std::vector<SignalValue> JSISignalStore::getSignals(const std::vector<SignalHandle>& handles) const {
+    std::vector<SignalValue> values(handles.size());
+    std::vector<std::pair<uint32_t, std::shared_ptr<Signal>>> deferred;
+    
+    uint32_t shardStart[kShardCount + 1] = {};
+    for (const SignalHandle& handle : handles) {
+        shardStart[(handle.slot & (kShardCount - 1)) + 1]++;
+    }
+    for (uint32_t i = 0; i < kShardCount; ++i) {
+        shardStart[i + 1] += shardStart[i];
+    }
+    std::vector<uint32_t> order(handles.size());
+    uint32_t cursor[kShardCount];
+    std::copy(shardStart, shardStart + kShardCount, cursor);
+    for (uint32_t i = 0; i < handles.size(); ++i) {
+        order[cursor[handles[i].slot & (kShardCount - 1)]++] = i;
+    }
+    
+    for (uint32_t shardIndex = 0; shardIndex < kShardCount; ++shardIndex) {
+        if (shardStart[shardIndex] == shardStart[shardIndex + 1]) {
+            continue;
+        }
+        const Shard& shard = shards_[shardIndex];
+        std::lock_guard<ShardMutex> lock(shard.mutex);
+        for (uint32_t i = shardStart[shardIndex]; i < shardStart[shardIndex + 1]; ++i) {
+            const SignalHandle& handle = handles[order[i]];
+            uint32_t local = handle.slot >> kShardBits;
+            if (local >= shard.slots.size()) {
+                continue;
+            }
+            const SignalSlot& slot = shard.slots[local];
+            if (slot.generation == handle.generation && slot.signal) {
+                if (slot.signal->computed_) {
+                    // Recomputing may notify subscribers: not under the shard lock
+                    deferred.emplace_back(order[i], slot.signal);
+                } else {
+                    values[order[i]] = slot.signal->getValue();
+                }
+            }
+        }
+    }
+    for (const auto& [index, signal] : deferred) {
+        values[index] = signal->getValue();
+    }
+    return values;
+}
+
+/**
+ * Resolve a handle to its signal for long-lived direct access
+ */
+std::shared_ptr<Signal> JSISignalStore::lookupSignal(SignalHandle handle) {
+    return findSignal(handle);
+}
+
+/**
+ * Check if signal exists
+ */
+bool JSISignalStore::hasSignal(const std::string& signalId) {
+    return hasSignal(parseSignalId(signalId));
+}
+
+bool JSISignalStore::hasSignal(SignalHandle handle) {
+    return findSignal(handle) != nullptr;
+}
+
+/**
+ * Delete a signal by ID
+ * Bumps the slot generation so outstanding handles become stale
+ * shared_ptr automatically cleans up memory when no references remain
+ */
+void JSISignalStore::deleteSignal(const std::string& signalId) {
+    deleteSignal(parseSignalId(signalId));
+}
+
+void JSISignalStore::deleteSignal(SignalHandle handle) {
+    Shard& shard = shards_[handle.slot & (kShardCount - 1)];
+    uint32_t local = handle.slot >> kShardBits;
+    std::shared_ptr<Signal> removed;
+    
+    {
+        std::lock_guard<ShardMutex> lock(shard.mutex);
+        if (local >= shard.slots.size()) {
+            return;
+        }
+        
+        SignalSlot& slot = shard.slots[local];
+        if (slot.generation != handle.generation || !slot.signal) {
+            return;
+        }
+        removed = std::move(slot.signal);
+        slot.signal.reset();
+        slot.generation = nextGeneration(slot.generation);
+        shard.freeSlots.push_back(local);
+    }
+    
+    signalCount_.fetch_sub(1, std::memory_order_relaxed);
+    detachSignal(*removed);
+    // Signal destructor (and its subscribers) runs outside the shard lock
+}
+
+/**
+ * Get current version number of a signal
+ * Used for efficient change detection in React renders
+ * Lock-free read using atomic operations
+ */
+uint64_t JSISignalStore::getSignalVersion(const std::string& signalId) {
+    return getSignalVersion(parseSignalId(signalId));
+}
+
+uint64_t JSISignalStore::getSignalVersion(SignalHandle handle) {
+    // Lock-free for plain signals; stale computeds are refreshed first
+    return requireSignal(handle)->getVersion();
+}
+
+double JSISignalStore::updateNumber(SignalHandle handle, Signal::NumericOp op, double operand) {
+    return requireSignal(handle)->updateNumber(op, operand);
+}
+
+bool JSISignalStore::compareAndSet(SignalHandle handle, uint64_t expectedVersion, const SignalValue& value) {
+    return requireSignal(handle)->compareAndSet(expectedVersion, value);
+}
+
+/**
+ * Batch update multiple signals atomically
+ * More efficient than individual updates when changing many signals
+ * Applies every write first, then notifies each changed signal once
+ */
+void JSISignalStore::batchUpdate(const std::vector<std::pair<std::string, SignalValue>>& updates) {
+    std::vector<std::pair<SignalHandle, SignalValue>> handleUpdates;
+    handleUpdates.reserve(updates.size());
+    
+    for (const auto& [signalId, value] : updates) {
+        handleUpdates.emplace_back(parseSignalId(signalId), value);
+    }
+    
+    batchUpdate(handleUpdates);
+}
+
+void JSISignalStore::batchUpdate(const std::vector<std::pair<SignalHandle, SignalValue>>& updates) {
+    struct PendingWrite {
+        std::shared_ptr<Signal> signal;
+        const SignalValue* value;
+        size_t position;  // Index of the last write to this signal in the batch
+        std::shared_ptr<const Signal::SubscriberList> subscribers;
+    };
+    std::vector<PendingWrite> writes;
+    writes.reserve(updates.size());
+    
+    for (size_t i = 0; i < updates.size(); ++i) {
+        const auto& [handle, value] = updates[i];
+        if (auto signal = findSignal(handle)) {
+            // Reject the whole batch before anything is written
+            if (signal->numeric_ && value.getType() != SignalValue::Type::Number) {
+                throw std::invalid_argument("Numeric signal requires a number value");
+            }
+            if (signal->computed_) {
+                throw std::runtime_error("Cannot write to a computed signal");
+            }
+            writes.push_back({std::move(signal), &value, i, nullptr});
+        }
+    }
+    
+    // Collapse repeated writes to one signal: last write wins
+    // stable_sort keeps batch order within each signal; address order is
+    // only used for locking
+    std::stable_sort(writes.begin(), writes.end(), [](const PendingWrite& a, const PendingWrite& b) {
+        return std::less<Signal*>()(a.signal.get(), b.signal.get());
+    });
+    size_t unique = 0;
+    for (size_t i = 0; i < writes.size(); ++i) {
+        if (unique > 0 && writes[unique - 1].signal == writes[i].signal) {
+            writes[unique - 1].value = writes[i].value;
+            writes[unique - 1].position = writes[i].position;
+        } else {
+            writes[unique++] = std::move(writes[i]);
+        }
+    }
+    writes.resize(unique);
+    
+    // Phase 1: apply every write before anyone is notified. Targets are
+    // locked in address order (no deadlocks between concurrent batches) and
+    // in chunks of kBatchLockChunk, so a batch never holds more than that
+    // many locks: other writers interleave at chunk boundaries at worst
+    for (size_t begin = 0; begin < writes.size(); begin += kBatchLockChunk) {
+        size_t end = std::min(writes.size(), begin + kBatchLockChunk);
+        std::array<std::unique_lock<Signal::Mutex>, kBatchLockChunk> locks;
+        for (size_t i = begin; i < end; ++i) {
+            locks[i - begin] = std::unique_lock<Signal::Mutex>(writes[i].signal->mutex_);
+        }
+        for (size_t i = begin; i < end; ++i) {
+            writes[i].subscribers = writes[i].signal->commit(*writes[i].value);
+        }
+    }
+    
+    // Phase 2: one notification pass, each changed signal notified once,
+    // in batch order of its last write (like the JS batcher)
+    std::sort(writes.begin(), writes.end(), [](const PendingWrite& a, const PendingWrite& b) {
+        return a.position < b.position;
+    });
+    for (const auto& write : writes) {
+        if (write.subscribers) {
+            Signal::notify(*write.subscribers, *write.value);
+        }
+    }
+}
+
+/**
+ * Get total number of signals in the store
+ */
+size_t JSISignalStore::getSignalCount() const {
+    return signalCount_.load(std::memory_order_relaxed);
+}
+
+/**
+ * Sum occupancy counters across the Signal pools
+ */
+SlabPool::Stats JSISignalStore::getSignalPoolStats() const {
+    SlabPool::Stats total{};
+    for (const auto& pool : signalPools_) {
+        SlabPool::Stats stats = pool->getStats();
+        total.blockSize = stats.blockSize;
+        total.blocksPerSlab = stats.blocksPerSlab;
+        total.slabCount += stats.slabCount;
+        total.liveBlocks += stats.liveBlocks;
+        total.freeBlocks += stats.freeBlocks;
+        total.totalAllocations += stats.totalAllocations;
+        total.bytesReserved += stats.bytesReserved;
+    }
+    return total;
+}
+
+/**
+ * Clear all signals from the store
+ * Every outstanding handle becomes stale
+ * Useful for testing or memory cleanup
+ */
+void JSISignalStore::clear() {
+    std::vector<std::shared_ptr<Signal>> removed;
+    
+    for (Shard& shard : shards_) {
+        std::lock_guard<ShardMutex> lock(shard.mutex);
+        shard.freeSlots.clear();
+        
+        for (uint32_t local = static_cast<uint32_t>(shard.slots.size()); local-- > 0;) {
+            SignalSlot& slot = shard.slots[local];
+            if (slot.signal) {
+                removed.push_back(std::move(slot.signal));
+                slot.signal.reset();
+                slot.generation = nextGeneration(slot.generation);
+                signalCount_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            shard.freeSlots.push_back(local);
+        }
+    }
+    
+    for (const auto& signal : removed) {
+        detachSignal(*signal);
+    }
+}
+
+/**
+ * Look up allocated chunks of the shared buffers
+ */
+std::shared_ptr<JSISignalStore::VersionBuffer::Chunk> JSISignalStore::getVersionChunk(uint32_t chunkIndex) const {
+    return versions_.chunk(chunkIndex);
+}
+
+std::shared_ptr<JSISignalStore::NumericBuffer::Chunk> JSISignalStore::getNumericChunk(uint32_t chunkIndex) const {
+    return numbers_.chunk(chunkIndex);
+}
+
+/**
+ * Unhook a signal that left the store from its shared buffer cells
+ * Host objects may keep writing to a deleted signal; those writes must not
+ * look like changes to whatever signal reuses the slot or numeric cell.
+ * The final counter bump tells JS readers of the old slot that its
+ * signal is gone. Computed signals also stop following their inputs
+ */
+void JSISignalStore::detachSignal(Signal& signal) {
+    std::atomic<uint32_t>* counter;
+    std::atomic<double>* numericCell;
+    {
+        std::lock_guard<Signal::Mutex> lock(signal.mutex_);
+        counter = signal.versionCounter_;
+        numericCell = signal.numericCell_;
+        signal.versionCounter_ = nullptr;
+        signal.numericCell_ = nullptr;
+    }
+    if (counter) {
+        counter->fetch_add(1, std::memory_order_release);
+    }
+    if (signal.computed_) {
+        computedGraph_->unlink(*signal.computed_);
+    }
+    if (numericCell) {
+        std::lock_guard<SyncPolicy::PlainMutex> lock(numericCellMutex_);
+        freeNumericCells_.push_back(signal.numericCellIndex_);
+    }
+}
+
+} // namespace signalforge
@@ -0,0 +1,543 @@
+#pragma once
+
+#include "chunkedBuffer.h"
+#include "lockStats.h"
+#include "signalPool.h"
+#include "syncPolicy.h"
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace signalforge {
+
+/**
+ * SignalValue - Type-safe wrapper for signal values
+ * Compact 16-byte tagged representation: numbers and booleans live inline,
+ * strings up to kInlineCapacity bytes are stored inline (small-string
+ * optimization) and longer strings live in a shared, reference-counted
+ * out-of-line buffer so copies never duplicate string data
+ *
+ * Objects and arrays are native trees of SignalValues, so structured state
+ * lives off the JS heap without a JSON round trip. Trees are immutable once
+ * built and shared between copies the same way long strings are
+ *
+ * Binary values (ArrayBuffer / TypedArray) keep their bytes in native
+ * memory that the JSI layer can hand to JS without copying. JS can write
+ * to that memory, so binary values compare (and hash) by identity, never
+ * by content
+ *
+ * SignalValue has no JSI dependency; conversion to and from jsi::Value
+ * lives in the binding layer (jsiStore.h)
+ */
+class SignalValue {
+public:
+    enum class Type : uint8_t {
+        Undefined,
+        Null,
+        Boolean,
+        Number,
+        String,
+        Object,
+        Array,
+        Binary
+    };
+
+    // JS view type a Binary value is returned as
+    enum class BinaryKind : uint8_t {
+        ArrayBuffer,
+        Int8Array,
+        Uint8Array,
+        Uint8ClampedArray,
+        Int16Array,
+        Uint16Array,
+        Int32Array,
+        Uint32Array,
+        Float32Array,
+        Float64Array,
+        BigInt64Array,
+        BigUint64Array
+    };
+
+    struct BinaryView {
+        uint8_t* data;
+        size_t size;
+        BinaryKind kind;
+    };
+
+    using ObjectEntries = std::vector<std::pair<std::string, SignalValue>>;
+    using ArrayElements = std::vector<SignalValue>;
+
+    // Longest string (in bytes) stored without a heap allocation
+    static constexpr size_t kInlineCapacity = 14;
+    // Deepest object/array nesting accepted from JS (guards against cycles)
+    static constexpr size_t kMaxDepth = 64;
+
+    SignalValue() noexcept;
+    explicit SignalValue(bool value) noexcept;
+    explicit SignalValue(double value) noexcept;
+    explicit SignalValue(const char* value);
+    explicit SignalValue(const std::string& value);
+    explicit SignalValue(std::string_view value);
+
+    static SignalValue null() noexcept;
+
+    // Structured value factories (entries keep insertion order, like JS)
+    static SignalValue object(ObjectEntries entries);
+    static SignalValue array(ArrayElements elements);
+
+    // Binary factories: copy bytes once, or adopt memory kept alive by owner
+    static SignalValue binary(const void* data, size_t size,
+                              BinaryKind kind = BinaryKind::ArrayBuffer);
+    static SignalValue binary(std::shared_ptr<void> owner, uint8_t* data, size_t size,
+                              BinaryKind kind = BinaryKind::ArrayBuffer);
+
+    SignalValue(const SignalValue& other) noexcept;
+    SignalValue(SignalValue&& other) noexcept;
+    SignalValue& operator=(const SignalValue& other) noexcept;
+    SignalValue& operator=(SignalValue&& other) noexcept;
+    ~SignalValue() { release(); }
+
+    Type getType() const { return type_; }
+    bool asBoolean() const;
+    double asNumber() const;
+    std::string_view asString() const;
+    const ObjectEntries& asObject() const;
+    const ArrayElements& asArray() const;
+    BinaryView asBinary() const;
+    const SignalValue* getProperty(std::string_view key) const;
+    
+    // Deep equality with JS Object.is semantics for numbers (NaN equals
+    // NaN, +0 differs from -0). Shared payloads compare by identity first
+    // and by cached content hash before falling back to a full compare;
+    // binary values are equal only when they share their bytes
+    bool operator==(const SignalValue& other) const;
+    bool operator!=(const SignalValue& other) const { return !(*this == other); }
+    
+    // Content hash consistent with operator== (cached for heap payloads)
+    uint64_t hash() const;
+
+private:
+    struct HeapCell;    // Common reference-counted header
+    struct HeapString;  // Shared out-of-line storage for long strings
+    struct HeapObject;  // Shared object entries
+    struct HeapArray;   // Shared array elements
+    struct HeapBinary;  // Shared native byte buffer
+
+    static constexpr uint8_t kHeapMarker = 0xFF;
+
+    // Raw payload: double, bool, inline chars or HeapCell* (see type_/inlineSize_)
+    alignas(8) unsigned char storage_[kInlineCapacity];
+    uint8_t inlineSize_;  // Inline string length, or kHeapMarker when out of line
+    Type type_;
+
+    SignalValue(Type type, std::string_view text);
+    SignalValue(Type type, HeapCell* cell) noexcept;
+
+    bool isHeap() const { return inlineSize_ == kHeapMarker; }
+    void copyRepresentation(const SignalValue& other) noexcept {
+        std::memcpy(storage_, other.storage_, kInlineCapacity);
+        inlineSize_ = other.inlineSize_;
+        type_ = other.type_;
+    }
+    HeapCell* heap() const;
+    void retain() const noexcept;
+    void release() noexcept;
+};
+
+static_assert(sizeof(SignalValue) == 16, "SignalValue must stay 16 bytes");
+
+inline SignalValue::SignalValue(const SignalValue& other) noexcept {
+    copyRepresentation(other);
+    retain();
+}
+
+inline SignalValue::SignalValue(SignalValue&& other) noexcept {
+    copyRepresentation(other);
+    other.inlineSize_ = 0;
+    other.type_ = Type::Undefined;
+}
+
+inline SignalValue& SignalValue::operator=(const SignalValue& other) noexcept {
+    if (this != &other) {
+        other.retain();
+        release();
+        copyRepresentation(other);
+    }
+    return *this;
+}
+
+inline SignalValue& SignalValue::operator=(SignalValue&& other) noexcept {
+    if (this != &other) {
+        release();
+        copyRepresentation(other);
+        other.inlineSize_ = 0;
+        other.type_ = Type::Undefined;
+    }
+    return *this;
+}
+
+/**
+ * Derives a computed signal's value from its inputs (in dependency order)
+ * Runs on whichever thread triggers the recompute and must not call back
+ * into the store
+ */
+using ComputeFunction = std::function<SignalValue(const std::vector<SignalValue>& inputs)>;
+
+struct ComputedNode;
+class ComputedGraph;
+
+/**
+ * Signal - Core signal container with atomic version tracking
+ * Uses shared_ptr for automatic memory management
+ * Version counter enables efficient change detection
+ *
+ * Reads are lock-free: the current value is an immutable snapshot behind
+ * an atomic pointer. Writers (serialized by mutex_) publish a new snapshot
+ * and retire the old one. Readers register in one of two epoch counters;
+ * writers flip the epoch and free a retired snapshot once both counters
+ * have drained since it was replaced. Readers never block on writers and
+ * never observe a freed value, and a steady stream of overlapping readers
+ * cannot hold back reclamation: only a read still open from before a
+ * snapshot was replaced keeps it alive. At most kMaxRetired snapshots are
+ * kept; past that a writer waits for those older reads to finish, so a
+ * readValue visitor must not write to the signal it is reading
+ */
+class Signal {
+public:
+    using Callback = std::function<void(const SignalValue&)>;
+    // Immutable subscriber snapshot; replaced wholesale on (un)subscribe
+    using SubscriberList = std::vector<std::pair<size_t, Callback>>;
+    
+    explicit Signal(const SignalValue& initialValue);
+    ~Signal();
+    
+    Signal(const Signal&) = delete;
+    Signal& operator=(const Signal&) = delete;
+    
+    SignalValue getValue() const;
+    // Returns false (no version bump, no notification) when unchanged
+    bool setValue(const SignalValue& newValue);
+    // Computed signals are brought up to date first, like readValue, so a
+    // stale computed reports the version its next read will have
+    uint64_t getVersion() const {
+        if (computed_) {
+            refreshComputed();
+        }
+        return loadVersion();
+    }
+    
+    // Numeric read-modify-write on any writable signal currently holding
+    // a number (throws otherwise): the value is read, checked and replaced
+    // under the writer lock, so concurrent writers never lose updates. At
+    // most one version bump and notification. Min/Max follow
+    // Math.min/Math.max (NaN wins, -0 < +0)
+    enum class NumericOp : uint8_t {
+        Add,
+        Min,
+        Max
+    };
+    // Returns the resulting value
+    double updateNumber(NumericOp op, double operand);
+    // Write only while the version still equals expectedVersion; returns
+    // false (nothing written) when another write got there first
+    bool compareAndSet(uint64_t expectedVersion, const SignalValue& newValue);
+    bool isNumeric() const { return numeric_; }
+    bool isComputed() const { return computed_ != nullptr; }
+    
+    // Inspect the current value in place without copying it
+    // Computed signals are brought up to date first
+    template <typename Visitor>
+    decltype(auto) readValue(Visitor&& visitor) const {
+        if (computed_) {
+            refreshComputed();
+        }
+        ReadSection section(*this);
+        return visitor(current_.load(std::memory_order_seq_cst)->value);
+    }
+    
+    // Subscribe a callback that fires when signal changes
+    size_t subscribe(Callback callback);
+    void unsubscribe(size_t id);
+    size_t getSubscriberCount() const;
+
+private:
+    friend class JSISignalStore;  // Batches drive the two-phase write directly
+    friend class ComputedGraph;   // Recomputes publish through commit()
+    
+    // Published value; immutable until reclaimed
+    struct ValueNode {
+        SignalValue value;
+        ValueNode* nextRetired = nullptr;
+    };
+    
+    // Marks a lock-free reader as active in the current read epoch for the
+    // duration of a read
+    class ReadSection {
+    public:
+        explicit ReadSection(const Signal& signal)
+            : signal_(signal), epoch_(signal.readEpoch_.load(std::memory_order_seq_cst)) {
+            signal_.activeReaders_[epoch_].fetch_add(1, std::memory_order_seq_cst);
+        }
+        ~ReadSection() {
+            signal_.activeReaders_[epoch_].fetch_sub(1, std::memory_order_release);
+        }
+    private:
+        const Signal& signal_;
+        uint32_t epoch_;
+    };
+    
+    using Mutex = SyncPolicy::Mutex<LockSite::Signal>;
+    
+    mutable Mutex mutex_;  // Serializes writers and subscriber list swaps
+    SyncPolicy::Atomic<ValueNode*> current_;
+    // Readers per epoch; new readers enter activeReaders_[readEpoch_]
+    mutable SyncPolicy::Atomic<uint32_t> activeReaders_[2];
+    SyncPolicy::Atomic<uint32_t> readEpoch_;  // 0 or 1, flipped by writers
+    // Replaced snapshots awaiting reclamation (writers only): retired_ since
+    // the last epoch flip, draining_ before it
+    ValueNode* retired_;
+    ValueNode* draining_;
+    size_t retiredCount_;  // Nodes in both lists
+    static constexpr size_t kMaxRetired = 64;
+    SyncPolicy::Atomic<uint64_t> version_;  // Thread-safe change tracking
+    
+    // Copy-on-write: writers share the current list by reference count
+    std::shared_ptr<const SubscriberList> subscribers_;
+    size_t nextSubscriberId_;
+    
+    // Slot change counter in the store's shared version buffer; bumped on
+    // every commit. Set once before the signal is reachable, cleared under
+    // mutex_ when the signal leaves the store
+    std::atomic<uint32_t>* versionCounter_;
+    
+    // Numeric signals only accept numbers and mirror every committed value
+    // into a cell of the store's shared numeric buffer. numeric_ never
+    // changes once the signal is reachable; numericCell_ is cleared under
+    // mutex_ when the signal leaves the store
+    bool numeric_;
+    std::atomic<double>* numericCell_;
+    uint32_t numericCellIndex_;
+    
+    // Computed signals only: dependency graph node. Set once before the
+    // signal is reachable; computed signals reject external writes
+    std::shared_ptr<ComputedNode> computed_;
+    
+    // Current value and version without refreshing a computed signal
+    SignalValue loadValue() const;
+    uint64_t loadVersion() const { return version_.load(std::memory_order_acquire); }
+    void refreshComputed() const;
+    
+    void publish(const SignalValue& newValue);
+    void reclaimRetired();
+    // Returns the number of nodes freed
+    static size_t freeNodes(ValueNode*& list);
+    
+    // Two-phase write: commit under mutex_ (nullptr when unchanged), then
+    // notify the returned subscribers after the lock is released
+    std::shared_ptr<const SubscriberList> commit(const SignalValue& newValue);
+    static void notify(const SubscriberList& subscribers, const SignalValue& value);
+};
+
+/**
+ * SignalHandle - dense slot index plus generation counter
+ * Identifies a signal without strings or hashing: lookups index straight
+ * into the store's slot table, and the generation rejects handles whose
+ * slot has since been freed and reused. Handles cross into JS as plain
+ * numbers (generation in the high bits, exact within 53-bit doubles)
+ */
+struct SignalHandle {
+    uint32_t slot = 0;
+    uint32_t generation = 0;  // 0 is never issued, so a default handle is invalid
+
+    static constexpr uint32_t kGenerationBits = 21;
+    static constexpr uint32_t kGenerationMask = (1u << kGenerationBits) - 1;
+
+    bool isValid() const { return generation != 0; }
+
+    uint64_t toBits() const {
+        return (static_cast<uint64_t>(generation) << 32) | slot;
+    }
+
+    static SignalHandle fromBits(uint64_t bits) {
+        SignalHandle handle;
+        handle.slot = static_cast<uint32_t>(bits & 0xFFFFFFFFu);
+        handle.generation = static_cast<uint32_t>(bits >> 32) & kGenerationMask;
+        return handle;
+    }
+
+    bool operator==(const SignalHandle& other) const {
+        return slot == other.slot && generation == other.generation;
+    }
+    bool operator!=(const SignalHandle& other) const { return !(*this == other); }
+};
+
+/**
+ * JSISignalStore - Main store managing all signals
+ * Thread-safe singleton exposed to JavaScript by installJSIBindings
+ * Provides direct C++ memory access for React Native; the store itself
+ * does not depend on JSI, so it builds and runs on plain Linux too
+ *
+ * Signals live in a dense slot table addressed by SignalHandle. String IDs
+ * ("sig_<handle>") are a textual form of the handle, so string lookups
+ * parse instead of hashing
+ *
+ * The slot table is split into kShardCount independently locked shards
+ * (slot index modulo kShardCount), and new signals are spread round-robin
+ * across them. Threads touching different signals almost never share a
+ * lock, so JS, UI and native producer threads don't serialize on one mutex
+ *
+ * Signals (with their shared_ptr control blocks) are allocated from
+ * kPoolCount slab pools instead of the global heap; a signal's pool is
+ * picked by its shard, so concurrent creates rarely share a pool lock
+ *
+ * Every slot also owns a 32-bit change counter in a shared version
+ * buffer (chunks of kVersionChunkSlots counters, indexed by slot). The
+ * counter advances whenever the slot's signal changes, is deleted or
+ * the slot is reused, so JS can detect changes by reading a typed array
+ * over the chunk instead of making a host call
+ *
+ * Numeric signals additionally own a cell in a shared Float64 buffer that
+ * always holds their current value, so JS reads them as plain typed-array
+ * loads without a host call or SignalValue conversion
+ *
+ * Computed signals are driven by a ComputedGraph (computedGraph.h)
+ *
+ * Shard, Signal, pool and graph locks and the bookkeeping atomics come
+ * from SyncPolicy (syncPolicy.h): a build with SIGNALFORGE_SINGLE_THREADED
+ * compiles them down to plain fields for stores only used from JS
+ */
+class JSISignalStore {
+public:
+    static JSISignalStore& getInstance();
+    
+    // Delete copy/move constructors for singleton
+    JSISignalStore(const JSISignalStore&) = delete;
+    JSISignalStore& operator=(const JSISignalStore&) = delete;
+    
+    // Core signal operations exposed to JSI
+    std::string createSignal(const SignalValue& initialValue);
+    SignalValue getSignal(const std::string& signalId);
+    void setSignal(const std::string& signalId, const SignalValue& value);
+    bool hasSignal(const std::string& signalId);
+    void deleteSignal(const std::string& signalId);
+    uint64_t getSignalVersion(const std::string& signalId);
+    
+    // Handle-based operations (no string conversion or hashing)
+    SignalHandle createSignalHandle(const SignalValue& initialValue);
+    SignalValue getSignal(SignalHandle handle);
+    void setSignal(SignalHandle handle, const SignalValue& value);
+    bool hasSignal(SignalHandle handle);
+    void deleteSignal(SignalHandle handle);
+    uint64_t getSignalVersion(SignalHandle handle);
+    
+    // Bulk read: each shard touched is locked once for the whole call.
+    // Stale or invalid handles read as undefined instead of throwing
+    std::vector<SignalValue> getSignals(const std::vector<SignalHandle>& handles) const;
+    
+    // Direct access to a signal for callers that hold on to it (host objects,
+    // native producers); returns nullptr when the handle is stale
+    std::shared_ptr<Signal> lookupSignal(SignalHandle handle);
+    
+    // Batch operations for performance
+    // Every write is applied (last write wins per signal) before a single
+    // notification pass runs. Writes are committed under at most
+    // kBatchLockChunk signal locks at a time: batches up to that size are
+    // isolated from other writers, larger ones may interleave with them
+    // between chunks (subscribers still only run after the whole batch)
+    static constexpr size_t kBatchLockChunk = 32;
+    void batchUpdate(const std::vector<std::pair<std::string, SignalValue>>& updates);
+    void batchUpdate(const std::vector<std::pair<SignalHandle, SignalValue>>& updates);
+    
+    // String ID <-> handle conversion
+    static std::string formatSignalId(SignalHandle handle);
+    static SignalHandle parseSignalId(const std::string& signalId);
+    
+    // Atomic numeric updates and versioned writes (see Signal::updateNumber
+    // and Signal::compareAndSet); throw if the signal doesn't exist
+    double updateNumber(SignalHandle handle, Signal::NumericOp op, double operand);
+    bool compareAndSet(SignalHandle handle, uint64_t expectedVersion, const SignalValue& value);
+    
+    // Memory management
+    size_t getSignalCount() const;
+    void clear();
+    
+    // Occupancy of the slab pools backing Signal allocations (summed)
+    SlabPool::Stats getSignalPoolStats() const;
+    
+    // Shared version buffer, indexed by slot (slots past its capacity get
+    // no counter). Numeric buffer, indexed by numeric cell
+    using VersionBuffer = ChunkedBuffer<std::atomic<uint32_t>, 12, 2048>;
+    using NumericBuffer = ChunkedBuffer<std::atomic<double>, 10, 4096>;
+    
+    // nullptr until a signal has been created in the chunk's range
+    std::shared_ptr<VersionBuffer::Chunk> getVersionChunk(uint32_t chunkIndex) const;
+    std::shared_ptr<NumericBuffer::Chunk> getNumericChunk(uint32_t chunkIndex) const;
+    
+    // Numeric signals: regular signals (handles, versions, subscribers,
+    // batches) that reject non-number writes and mirror their value into
+    // a numeric buffer cell
+    SignalHandle createNumericSignal(double initialValue);
+    // Numeric buffer cell of a live numeric signal, or -1
+    int64_t getNumericCell(SignalHandle handle);
+    
+    // Computed signals: read-only signals derived from explicit
+    // dependencies (plain or computed) by a native function. They are
+    // recomputed lazily on read, or right after an input changes while
+    // they have subscribers, and only bump their version when the result
+    // changes. Throws if a dependency doesn't exist or compute throws
+    SignalHandle createComputed(const std::vector<SignalHandle>& dependencies,
+                                ComputeFunction compute);
+
+private:
+    JSISignalStore();
+    ~JSISignalStore();
+    
+    static constexpr uint32_t kShardBits = 6;
+    static constexpr uint32_t kShardCount = 1u << kShardBits;
+    static constexpr uint32_t kPoolCount = 8;
+    // Room for the allocate_shared control block next to the Signal
+    static constexpr size_t kSignalBlockSize = sizeof(Signal) + 32;
+    
+    struct SignalSlot {
+        std::shared_ptr<Signal> signal;
+        uint32_t generation = 1;
+    };
+    
+    using ShardMutex = SyncPolicy::Mutex<LockSite::Shard>;
+    
+    // One lock per shard; cache-line aligned so shards don't false-share
+    struct alignas(64) Shard {
+        mutable ShardMutex mutex;
+        std::vector<SignalSlot> slots;     // Indexed by slot >> kShardBits
+        std::vector<uint32_t> freeSlots;   // Reusable local indices (LIFO)
+    };
+    
+    // Declared before shards_ so pools and version chunks outlive the
+    // signals they back
+    std::vector<std::unique_ptr<SlabPool>> signalPools_;
+    VersionBuffer versions_;
+    NumericBuffer numbers_;
+    SyncPolicy::PlainMutex numericCellMutex_;  // Guards numeric cell allocation
+    std::vector<uint32_t> freeNumericCells_;
+    uint32_t nextNumericCell_;
+    std::unique_ptr<ComputedGraph> computedGraph_;
+    Shard shards_[kShardCount];
+    SyncPolicy::Atomic<uint32_t> nextShard_;  // Round-robin placement for new signals
+    SyncPolicy::Atomic<size_t> signalCount_;
+    
+    std::shared_ptr<Signal> findSignal(SignalHandle handle) const;
+    std::shared_ptr<Signal> requireSignal(SignalHandle handle) const;
+    
+    SignalHandle addSignal(const SignalValue& initialValue, bool numeric,
+                           std::shared_ptr<ComputedNode> computed = nullptr);
+    void detachSignal(Signal& signal);
+};
+
+} // namespace signalforge
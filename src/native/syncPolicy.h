@@ -0,0 +1,124 @@
+#pragma once
+
+#include "lockStats.h"
+#include <atomic>
+#include <mutex>
+
+namespace signalforge {
+
+/**
+ * NullMutex - Lockable that does nothing
+ * Works with lock_guard/unique_lock so locking code reads the same under
+ * either policy
+ */
+class NullMutex {
+public:
+    NullMutex() = default;
+    NullMutex(const NullMutex&) = delete;
+    NullMutex& operator=(const NullMutex&) = delete;
+
+    void lock() {}
+    bool try_lock() { return true; }
+    void unlock() {}
+};
+
+/**
+ * UnsyncedAtomic - the std::atomic interface over a plain value
+ * Memory orders are accepted and ignored; every operation is an ordinary
+ * load or store the compiler is free to optimize
+ */
+template <typename T>
+class UnsyncedAtomic {
+public:
+    UnsyncedAtomic() = default;
+    constexpr UnsyncedAtomic(T value) noexcept : value_(value) {}
+    UnsyncedAtomic(const UnsyncedAtomic&) = delete;
+    UnsyncedAtomic& operator=(const UnsyncedAtomic&) = delete;
+
+    T load(std::memory_order = std::memory_order_seq_cst) const noexcept { return value_; }
+    void store(T value, std::memory_order = std::memory_order_seq_cst) noexcept { value_ = value; }
+
+    T exchange(T value, std::memory_order = std::memory_order_seq_cst) noexcept {
+        T previous = value_;
+        value_ = value;
+        return previous;
+    }
+
+    bool compare_exchange_strong(T& expected, T desired,
+                                 std::memory_order = std::memory_order_seq_cst,
+                                 std::memory_order = std::memory_order_seq_cst) noexcept {
+        if (value_ == expected) {
+            value_ = desired;
+            return true;
+        }
+        expected = value_;
+        return false;
+    }
+
+    bool compare_exchange_weak(T& expected, T desired,
+                               std::memory_order success = std::memory_order_seq_cst,
+                               std::memory_order failure = std::memory_order_seq_cst) noexcept {
+        return compare_exchange_strong(expected, desired, success, failure);
+    }
+
+    T fetch_add(T delta, std::memory_order = std::memory_order_seq_cst) noexcept {
+        T previous = value_;
+        value_ = static_cast<T>(value_ + delta);
+        return previous;
+    }
+
+    T fetch_sub(T delta, std::memory_order = std::memory_order_seq_cst) noexcept {
+        T previous = value_;
+        value_ = static_cast<T>(value_ - delta);
+        return previous;
+    }
+
+private:
+    T value_;
+};
+
+/**
+ * Synchronization policies for the store, signals and the computed graph
+ *
+ * ThreadSafePolicy (default): instrumented mutexes and std::atomic; any
+ * thread may read, write and subscribe.
+ *
+ * SingleThreadedPolicy: no mutexes and no atomic instructions, for apps
+ * that only touch the store from the JS thread. Every store, Signal and
+ * TypedSignal call, including WriteQueue drains and NativeSignal writes,
+ * must then come from that one thread. The version and numeric buffers
+ * stay atomic: JS maps their memory directly
+ *
+ * The policy is chosen at build time with SIGNALFORGE_SINGLE_THREADED and
+ * changes class layouts, so everything including these headers must be
+ * built with the same setting (the CMake option exports it)
+ */
+struct ThreadSafePolicy {
+    static constexpr bool kThreadSafe = true;
+
+    template <LockSite Site>
+    using Mutex = InstrumentedMutex<Site>;
+    using PlainMutex = std::mutex;  // Rarely taken locks (not instrumented)
+
+    template <typename T>
+    using Atomic = std::atomic<T>;
+};
+
+struct SingleThreadedPolicy {
+    static constexpr bool kThreadSafe = false;
+
+    template <LockSite Site>
+    using Mutex = NullMutex;
+    using PlainMutex = NullMutex;
+
+    template <typename T>
+    using Atomic = UnsyncedAtomic<T>;
+};
+
+#if defined(SIGNALFORGE_SINGLE_THREADED) && SIGNALFORGE_SINGLE_THREADED
+using SyncPolicy = SingleThreadedPolicy;
+#else
+using SyncPolicy = ThreadSafePolicy;
+#endif
+
+} // namespace signalforge
@@ -0,0 +1,266 @@
+#pragma once
+
+#include "signalStore.h"
+#include "syncPolicy.h"
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace signalforge {
+
+/**
+ * SignalBuffer - binary payload of a TypedSignal<SignalBuffer>
+ * Adopts memory kept alive by owner, like SignalValue::binary; the bytes
+ * must not change once the buffer has been published
+ */
+struct SignalBuffer {
+    std::shared_ptr<void> owner;
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    SignalValue::BinaryKind kind = SignalValue::BinaryKind::ArrayBuffer;
+
+    // Copy bytes into a new owned buffer
+    static SignalBuffer copy(const void* bytes, size_t size,
+                             SignalValue::BinaryKind kind = SignalValue::BinaryKind::ArrayBuffer) {
+        auto storage = std::make_shared<std::vector<uint8_t>>(size);
+        if (size > 0) {
+            std::memcpy(storage->data(), bytes, size);
+        }
+        uint8_t* data = storage->data();
+        return SignalBuffer{std::move(storage), data, size, kind};
+    }
+};
+
+/**
+ * SignalTraits<T> - compile-time type policy for TypedSignal<T>
+ * equals decides whether a write is a change (JS Object.is semantics for
+ * numbers); toValue bridges into the dynamic SignalValue world (stores,
+ * batches, computeds) without copying heap payloads
+ */
+template <typename T>
+struct SignalTraits;
+
+template <>
+struct SignalTraits<double> {
+    // NaN equals NaN, +0 differs from -0
+    static bool equals(double a, double b) {
+        if (std::isnan(a) || std::isnan(b)) {
+            return std::isnan(a) && std::isnan(b);
+        }
+        return a == b && std::signbit(a) == std::signbit(b);
+    }
+    static SignalValue toValue(double value) { return SignalValue(value); }
+};
+
+template <>
+struct SignalTraits<int64_t> {
+    static bool equals(int64_t a, int64_t b) { return a == b; }
+    static SignalValue toValue(int64_t value) { return SignalValue(static_cast<double>(value)); }
+};
+
+template <>
+struct SignalTraits<bool> {
+    static bool equals(bool a, bool b) { return a == b; }
+    static SignalValue toValue(bool value) { return SignalValue(value); }
+};
+
+template <>
+struct SignalTraits<std::string> {
+    static bool equals(const std::string& a, const std::string& b) { return a == b; }
+    static SignalValue toValue(const std::string& value) { return SignalValue(value); }
+};
+
+template <>
+struct SignalTraits<SignalBuffer> {
+    // Same memory is equal without a compare; otherwise compare contents
+    static bool equals(const SignalBuffer& a, const SignalBuffer& b) {
+        if (a.kind != b.kind || a.size != b.size) {
+            return false;
+        }
+        return a.data == b.data || a.size == 0 || std::memcmp(a.data, b.data, a.size) == 0;
+    }
+    static SignalValue toValue(const SignalBuffer& value) {
+        return SignalValue::binary(value.owner, value.data, value.size, value.kind);
+    }
+};
+
+/**
+ * TypedStorage - current value of a TypedSignal
+ * Trivially copyable types (double, int64, bool) live in a single atomic:
+ * reads are one load and never allocate. Other types are immutable
+ * snapshots behind an atomically swapped shared_ptr
+ */
+template <typename T, bool Trivial = std::is_trivially_copyable<T>::value>
+class TypedStorage {
+public:
+    explicit TypedStorage(T value) : value_(value) {}
+
+    T load() const { return value_.load(std::memory_order_acquire); }
+    void store(T value) { value_.store(value, std::memory_order_release); }
+
+    template <typename Visitor>
+    decltype(auto) read(Visitor&& visitor) const {
+        T value = load();
+        return visitor(static_cast<const T&>(value));
+    }
+
+private:
+    SyncPolicy::Atomic<T> value_;
+};
+
+template <typename T>
+class TypedStorage<T, false> {
+public:
+    explicit TypedStorage(T value) : value_(std::make_shared<const T>(std::move(value))) {}
+
+    T load() const { return *snapshot(); }
+    void store(T value) {
+        auto next = std::make_shared<const T>(std::move(value));
+        if constexpr (SyncPolicy::kThreadSafe) {
+            std::atomic_store(&value_, std::move(next));
+        } else {
+            value_ = std::move(next);
+        }
+    }
+
+    // Holds the snapshot for the duration of the visit; no copy of T
+    template <typename Visitor>
+    decltype(auto) read(Visitor&& visitor) const {
+        std::shared_ptr<const T> current = snapshot();
+        return visitor(*current);
+    }
+
+private:
+    std::shared_ptr<const T> value_;
+
+    std::shared_ptr<const T> snapshot() const {
+        if constexpr (SyncPolicy::kThreadSafe) {
+            return std::atomic_load(&value_);
+        } else {
+            return value_;
+        }
+    }
+};
+
+/**
+ * TypedSignal<T> - signal with a value type fixed at compile time
+ * Supported types: double, int64_t, bool, std::string and SignalBuffer
+ *
+ * Signal stores a SignalValue and dispatches on its runtime Type for every
+ * compare and conversion. A TypedSignal stores T itself (see TypedStorage)
+ * and its equality and JSI conversion (TypedJSI in jsiStore.h) are chosen
+ * at compile time, so hot single-type signals skip the dispatch and carry
+ * none of the dynamic machinery (snapshot retirement, numeric/computed
+ * bookkeeping). Use Signal where a value's type can change
+ *
+ * Typed signals are not in the store's slot table: owners keep them by
+ * shared_ptr and expose them to JS through TypedSignalHostObject or their
+ * own host functions. Thread-safety follows SyncPolicy like Signal: reads
+ * are lock-free (a short internal lock for string/buffer snapshots),
+ * writes are serialized and notify subscribers on the writing thread
+ */
+template <typename T>
+class TypedSignal {
+public:
+    using Traits = SignalTraits<T>;
+    using Callback = std::function<void(const T&)>;
+    using SubscriberList = std::vector<std::pair<size_t, Callback>>;
+
+    explicit TypedSignal(T initialValue = T())
+        : value_(std::move(initialValue)),
+          version_(0),
+          subscribers_(std::make_shared<const SubscriberList>()),
+          nextSubscriberId_(0) {}
+
+    TypedSignal(const TypedSignal&) = delete;
+    TypedSignal& operator=(const TypedSignal&) = delete;
+
+    T get() const { return value_.load(); }
+    uint64_t getVersion() const { return version_.load(std::memory_order_acquire); }
+
+    // Inspect the current value in place (strings and buffers aren't copied)
+    template <typename Visitor>
+    decltype(auto) read(Visitor&& visitor) const {
+        return value_.read(std::forward<Visitor>(visitor));
+    }
+
+    // Returns false (no version bump, no notification) when unchanged
+    bool set(T newValue) {
+        std::shared_ptr<const SubscriberList> subscribers;
+        {
+            std::lock_guard<Mutex> lock(mutex_);
+            bool unchanged = value_.read([&](const T& current) {
+                return Traits::equals(current, newValue);
+            });
+            if (unchanged) {
+                return false;
+            }
+            value_.store(newValue);
+            version_.fetch_add(1, std::memory_order_release);
+            subscribers = subscribers_;
+        }
+        for (const auto& [id, callback] : *subscribers) {
+            try {
+                callback(newValue);
+            } catch (...) {
+                // Swallow exceptions to prevent one subscriber from breaking others
+            }
+        }
+        return true;
+    }
+
+    // Current value as a dynamic SignalValue (heap payloads are shared)
+    SignalValue toValue() const {
+        return value_.read([](const T& current) { return Traits::toValue(current); });
+    }
+
+    size_t subscribe(Callback callback) {
+        std::lock_guard<Mutex> lock(mutex_);
+        size_t id = nextSubscriberId_++;
+        auto next = std::make_shared<SubscriberList>();
+        next->reserve(subscribers_->size() + 1);
+        *next = *subscribers_;
+        next->emplace_back(id, std::move(callback));
+        subscribers_ = std::move(next);
+        return id;
+    }
+
+    void unsubscribe(size_t id) {
+        std::lock_guard<Mutex> lock(mutex_);
+        auto next = std::make_shared<SubscriberList>();
+        next->reserve(subscribers_->size());
+        for (const auto& entry : *subscribers_) {
+            if (entry.first != id) {
+                next->push_back(entry);
+            }
+        }
+        if (next->size() != subscribers_->size()) {
+            subscribers_ = std::move(next);
+        }
+    }
+
+    size_t getSubscriberCount() const {
+        std::lock_guard<Mutex> lock(mutex_);
+        return subscribers_->size();
+    }
+
+private:
+    using Mutex = SyncPolicy::Mutex<LockSite::Signal>;
+
+    mutable Mutex mutex_;  // Serializes writers and subscriber list swaps
+    TypedStorage<T> value_;
+    SyncPolicy::Atomic<uint64_t> version_;
+    // Copy-on-write: writers share the current list by reference count
+    std::shared_ptr<const SubscriberList> subscribers_;
+    size_t nextSubscriberId_;
+};
+
+} // namespace signalforge
@@ -0,0 +1,192 @@
+#include "writeQueue.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace signalforge {
+
+namespace {
+
+constexpr uint64_t kTagIncrement = uint64_t(1) << 32;
+constexpr uint64_t kTagMask = ~uint64_t(0) << 32;
+
+} // namespace
+
+WriteQueue::WriteQueue(JSISignalStore& store, Mode mode, Wakeup wakeup)
+    : store_(store),
+      mode_(mode),
+      wakeup_(std::move(wakeup)),
+      head_(nullptr),
+      rejected_(0),
+      freeHead_(0),
+      blockCount_(0) {
+    for (auto& block : blocks_) {
+        block.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Writes still queued are discarded
+ */
+WriteQueue::~WriteQueue() {
+    Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+    while (node) {
+        Node* next = node->next;
+        if (node->index == kHeapNode) {
+            delete node;
+        }
+        node = next;
+    }
+    for (auto& block : blocks_) {
+        delete[] block.load(std::memory_order_acquire);
+    }
+}
+
+/**
+ * Pop a recycled node, or grow the pool when none is free
+ * The tag in freeHead_ changes on every push and pop, so a head that was
+ * popped and pushed back between our load and CAS fails the CAS (no ABA).
+ * Reading nextFree of a node another producer just took is harmless: it
+ * stays valid memory and the CAS then fails
+ */
+WriteQueue::Node* WriteQueue::acquireNode() {
+    uint64_t head = freeHead_.load(std::memory_order_acquire);
+    while (uint32_t slot = static_cast<uint32_t>(head)) {
+        Node& node = nodeAt(slot - 1);
+        uint64_t next = ((head & kTagMask) + kTagIncrement) | node.nextFree.load(std::memory_order_relaxed);
+        if (freeHead_.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire)) {
+            return &node;
+        }
+    }
+    return addBlock();
+}
+
+void WriteQueue::releaseNode(Node* node) {
+    if (node->index == kHeapNode) {
+        delete node;
+        return;
+    }
+    node->value = SignalValue();  // Drop the payload now, not at reuse
+    uint64_t head = freeHead_.load(std::memory_order_relaxed);
+    uint64_t next;
+    do {
+        node->nextFree.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        next = ((head & kTagMask) + kTagIncrement) | (node->index + 1);
+    } while (!freeHead_.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/**
+ * Allocate a block of nodes: keep the first, free the rest
+ * Past kMaxBlocks, fall back to one heap node per write
+ */
+WriteQueue::Node* WriteQueue::addBlock() {
+    uint32_t block = kMaxBlocks;
+    if (blockCount_.load(std::memory_order_relaxed) < kMaxBlocks) {
+        block = blockCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (block >= kMaxBlocks) {
+        return new Node();
+    }
+
+    Node* nodes = new Node[kBlockNodes];
+    for (uint32_t i = 0; i < kBlockNodes; ++i) {
+        nodes[i].index = block * kBlockNodes + i;
+    }
+    blocks_[block].store(nodes, std::memory_order_release);
+    for (uint32_t i = 1; i < kBlockNodes; ++i) {
+        releaseNode(&nodes[i]);
+    }
+    return &nodes[0];
+}
+
+/**
+ * Push a write; wakes the consumer when the queue was empty
+ * The consumer takes the whole stack with one exchange, so pushes never
+ * race with pops of individual nodes (no ABA)
+ */
+void WriteQueue::enqueue(SignalHandle handle, SignalValue value) {
+    Node* node = acquireNode();
+    node->handle = handle;
+    node->value = std::move(value);
+    Node* head = head_.load(std::memory_order_relaxed);
+    do {
+        node->next = head;
+    } while (!head_.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+
+    if (!head && wakeup_) {
+        wakeup_();
+    }
+}
+
+/**
+ * Take every queued write and apply it on the calling thread
+ */
+size_t WriteQueue::drain() {
+    Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+    if (!node) {
+        return 0;
+    }
+
+    // The stack is newest first; restore enqueue order
+    std::vector<std::pair<SignalHandle, SignalValue>> writes;
+    while (node) {
+        writes.emplace_back(node->handle, std::move(node->value));
+        Node* next = node->next;
+        releaseNode(node);
+        node = next;
+    }
+    std::reverse(writes.begin(), writes.end());
+    size_t taken = writes.size();
+
+    if (mode_ == Mode::Sequential) {
+        for (const auto& [handle, value] : writes) {
+            apply(handle, value);
+        }
+        return taken;
+    }
+
+    // Newest write per signal, kept at its first position
+    std::unordered_map<uint64_t, size_t> positions;
+    positions.reserve(writes.size());
+    size_t unique = 0;
+    for (size_t i = 0; i < writes.size(); ++i) {
+        auto [it, inserted] = positions.emplace(writes[i].first.toBits(), unique);
+        if (inserted) {
+            writes[unique++] = std::move(writes[i]);
+        } else {
+            writes[it->second].second = std::move(writes[i].second);
+        }
+    }
+    writes.resize(unique);
+
+    try {
+        store_.batchUpdate(writes);
+    } catch (const std::exception&) {
+        // A batch is all or nothing; apply one by one to keep the valid writes
+        for (const auto& [handle, value] : writes) {
+            apply(handle, value);
+        }
+    }
+    return taken;
+}
+
+/**
+ * Apply one write; writes to deleted signals are skipped like in
+ * batchUpdate, writes the signal refuses are counted
+ */
+void WriteQueue::apply(SignalHandle handle, const SignalValue& value) {
+    std::shared_ptr<Signal> signal = store_.lookupSignal(handle);
+    if (!signal) {
+        return;
+    }
+    try {
+        signal->setValue(value);
+    } catch (const std::exception&) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+} // namespace signalforge
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "signalStore.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace signalforge {
+
+/**
+ * WriteQueue - enqueue-only signal writes for native producer threads
+ *
+ * setSignal runs subscribers on the calling thread, so a sensor or socket
+ * thread writing directly can end up waiting on UI work. Producers push
+ * writes here instead: enqueue takes a recycled node from the queue's
+ * lock-free free list and pushes it with a CAS on a lock-free stack, never
+ * a mutex, so producers never wait on the consumer or on each other's
+ * locks. A consumer thread of the owner's choosing drains the queue in
+ * bulk, applies the writes to the store there and recycles the nodes
+ *
+ * Nodes are allocated kBlockNodes at a time, so enqueue only reaches the
+ * allocator while the queue grows to its high-water mark; past
+ * kMaxBlocks blocks each extra node is allocated and freed on its own
+ *
+ * Modes:
+ * - Coalesce: a drain applies only the newest write per signal, as one
+ *   batchUpdate (one notification per changed signal)
+ * - Sequential: every write is applied in order, each with its own
+ *   version bump and notification
+ *
+ * Writes to signals deleted before the drain are skipped, as in
+ * batchUpdate; writes the signal refuses (computed signal, non-number for
+ * a numeric signal) are dropped and counted
+ *
+ * Any number of threads may enqueue; drain must only be called from one
+ * thread at a time
+ */
+class WriteQueue {
+public:
+    enum class Mode : uint8_t {
+        Coalesce,
+        Sequential
+    };
+
+    // Called by the producer whose write made the queue non-empty, so the
+    // owner can schedule a drain; must not block
+    using Wakeup = std::function<void()>;
+
+    explicit WriteQueue(JSISignalStore& store, Mode mode = Mode::Coalesce, Wakeup wakeup = nullptr);
+    ~WriteQueue();
+
+    WriteQueue(const WriteQueue&) = delete;
+    WriteQueue& operator=(const WriteQueue&) = delete;
+
+    // Producer side (any thread, lock-free)
+    void enqueue(SignalHandle handle, SignalValue value);
+
+    // Consumer side: apply everything enqueued so far; returns the number
+    // of writes taken off the queue
+    size_t drain();
+
+    bool empty() const { return head_.load(std::memory_order_acquire) == nullptr; }
+    Mode mode() const { return mode_; }
+    // Writes dropped because the store rejected them
+    uint64_t getRejectedCount() const { return rejected_.load(std::memory_order_relaxed); }
+
+    static constexpr uint32_t kBlockNodes = 256;
+    static constexpr uint32_t kMaxBlocks = 256;
+
+private:
+    static constexpr uint32_t kHeapNode = UINT32_MAX;  // Node not in a block
+
+    struct Node {
+        SignalHandle handle;
+        SignalValue value;
+        Node* next = nullptr;
+        std::atomic<uint32_t> nextFree{0};  // Free list link (index + 1, 0 ends)
+        uint32_t index = kHeapNode;
+    };
+
+    JSISignalStore& store_;
+    const Mode mode_;
+    const Wakeup wakeup_;
+    std::atomic<Node*> head_;  // Newest first (Treiber stack)
+    std::atomic<uint64_t> rejected_;
+
+    // Recycled nodes, addressed by index so the free list head can carry
+    // an ABA tag: high 32 bits count updates, low 32 bits are index + 1
+    std::atomic<uint64_t> freeHead_;
+    std::atomic<uint32_t> blockCount_;
+    std::atomic<Node*> blocks_[kMaxBlocks];
+
+    Node* acquireNode();
+    void releaseNode(Node* node);
+    Node* addBlock();
+    Node& nodeAt(uint32_t index) const {
+        return blocks_[index / kBlockNodes].load(std::memory_order_acquire)[index % kBlockNodes];
+    }
+
+    void apply(SignalHandle handle, const SignalValue& value);
+};
+
+} // namespace signalforge
@@ -0,0 +1,800 @@
+// Native core tests for signalforge-core (no JSI required)
+// Run through ctest: cmake -S . -B build && cmake --build build && ctest --test-dir build
+
+#include "coalescedNotifier.h"
+#include "expression.h"
+#include "nativeSignals.h"
+#include "signalStore.h"
+#include "typedSignal.h"
+#include "writeQueue.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace signalforge;
+
+namespace {
+
+int failures = 0;
+
+#define EXPECT(condition)                                                   \
+    do {                                                                    \
+        if (!(condition)) {                                                 \
+            std::fprintf(stderr, "  %s:%d: EXPECT(%s) failed\n",            \
+                         __FILE__, __LINE__, #condition);                   \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+struct TestCase {
+    const char* name;
+    std::function<void()> run;
+};
+
+// Run producers on their own threads, or one after another on this thread
+// when the store is built with the single-threaded policy
+void runProducers(int count, const std::function<void(int)>& producer) {
+    if (!SyncPolicy::kThreadSafe) {
+        for (int t = 0; t < count; t++) {
+            producer(t);
+        }
+        return;
+    }
+    std::vector<std::thread> threads;
+    for (int t = 0; t < count; t++) {
+        threads.emplace_back(producer, t);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+// Reader spinning until done while producers run (thread-safe policy only)
+std::thread startReader(std::atomic<bool>& done, std::function<void()> read) {
+    if (!SyncPolicy::kThreadSafe) {
+        return std::thread();
+    }
+    return std::thread([&done, read = std::move(read)] {
+        while (!done.load()) {
+            read();
+        }
+    });
+}
+
+JSISignalStore& freshStore() {
+    JSISignalStore& store = JSISignalStore::getInstance();
+    store.clear();
+    return store;
+}
+
+void testValueRepresentation() {
+    EXPECT(SignalValue().getType() == SignalValue::Type::Undefined);
+    EXPECT(SignalValue::null().getType() == SignalValue::Type::Null);
+    EXPECT(SignalValue(true).asBoolean());
+    EXPECT(SignalValue(2.5).asNumber() == 2.5);
+
+    SignalValue shortText("short");
+    SignalValue longText(std::string(100, 'x'));
+    EXPECT(shortText.asString() == "short");
+    EXPECT(longText.asString().size() == 100);
+
+    SignalValue copy = longText;
+    EXPECT(copy == longText);
+    EXPECT(copy.hash() == longText.hash());
+}
+
+void testObjectIsEquality() {
+    double nan = std::nan("");
+    EXPECT(SignalValue(nan) == SignalValue(nan));
+    EXPECT(SignalValue(0.0) != SignalValue(-0.0));
+
+    SignalValue::ObjectEntries entries;
+    entries.emplace_back("count", SignalValue(1.0));
+    entries.emplace_back("label", SignalValue("a label longer than inline"));
+    SignalValue first = SignalValue::object(entries);
+    SignalValue second = SignalValue::object(entries);
+    EXPECT(first == second);
+    EXPECT(first.getProperty("count")->asNumber() == 1.0);
+    EXPECT(first.getProperty("missing") == nullptr);
+}
+
+void testBinaryValues() {
+    const uint8_t bytes[] = {1, 2, 3, 4};
+    SignalValue value = SignalValue::binary(bytes, sizeof(bytes),
+                                            SignalValue::BinaryKind::Uint8Array);
+    SignalValue::BinaryView view = value.asBinary();
+    EXPECT(view.size == 4);
+    EXPECT(view.data[3] == 4);
+    EXPECT(view.kind == SignalValue::BinaryKind::Uint8Array);
+
+    // Binary values compare by identity: JS may write to the shared bytes
+    SignalValue copy = value;
+    SignalValue sameBytes = SignalValue::binary(bytes, sizeof(bytes),
+                                                SignalValue::BinaryKind::Uint8Array);
+    EXPECT(copy == value && copy.hash() == value.hash());
+    EXPECT(sameBytes != value);
+    view.data[0] = 9;
+    EXPECT(copy == value && copy.asBinary().data[0] == 9);
+
+    JSISignalStore& store = freshStore();
+    SignalHandle handle = store.createSignalHandle(value);
+    EXPECT(!store.lookupSignal(handle)->setValue(copy));
+    EXPECT(store.lookupSignal(handle)->setValue(sameBytes));
+    EXPECT(store.getSignalVersion(handle) == 1);
+}
+
+void testHandlesAndIds() {
+    JSISignalStore& store = freshStore();
+    SignalHandle handle = store.createSignalHandle(SignalValue(1.0));
+    EXPECT(handle.isValid());
+    EXPECT(store.getSignal(handle).asNumber() == 1.0);
+
+    std::string id = JSISignalStore::formatSignalId(handle);
+    EXPECT(JSISignalStore::parseSignalId(id) == handle);
+    EXPECT(store.getSignal(id).asNumber() == 1.0);
+
+    store.deleteSignal(handle);
+    EXPECT(!store.hasSignal(handle));
+
+    // A reused slot must not resurrect the stale handle
+    SignalHandle reused = store.createSignalHandle(SignalValue(2.0));
+    EXPECT(reused != handle);
+    EXPECT(!store.hasSignal(handle));
+
+    bool threw = false;
+    try {
+        store.getSignal(handle);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    EXPECT(threw);
+}
+
+void testUnchangedWritesAreSkipped() {
+    JSISignalStore& store = freshStore();
+    SignalHandle handle = store.createSignalHandle(SignalValue("value"));
+    std::shared_ptr<Signal> signal = store.lookupSignal(handle);
+
+    int notifications = 0;
+    signal->subscribe([&](const SignalValue&) { notifications++; });
+
+    store.setSignal(handle, SignalValue("value"));
+    EXPECT(store.getSignalVersion(handle) == 0);
+    EXPECT(notifications == 0);
+
+    store.setSignal(handle, SignalValue("changed"));
+    EXPECT(store.getSignalVersion(handle) == 1);
+    EXPECT(notifications == 1);
+}
+
+void testBatchNotifiesOnce() {
+    JSISignalStore& store = freshStore();
+    SignalHandle a = store.createSignalHandle(SignalValue(0.0));
+    SignalHandle b = store.createSignalHandle(SignalValue(0.0));
+
+    std::vector<double> seen;
+    store.lookupSignal(a)->subscribe([&](const SignalValue& value) {
+        // Every write in the batch is applied before anyone is notified
+        seen.push_back(value.asNumber());
+        seen.push_back(store.getSignal(b).asNumber());
+    });
+
+    store.batchUpdate(std::vector<std::pair<SignalHandle, SignalValue>>{
+        {a, SignalValue(1.0)},
+        {b, SignalValue(5.0)},
+        {a, SignalValue(2.0)},
+    });
+
+    EXPECT(seen.size() == 2);
+    EXPECT(seen.size() == 2 && seen[0] == 2.0 && seen[1] == 5.0);
+    EXPECT(store.getSignalVersion(a) == 1);
+
+    // Signals are notified in batch order of their last write, whatever
+    // their addresses
+    SignalHandle x = store.createSignalHandle(SignalValue(0.0));
+    SignalHandle y = store.createSignalHandle(SignalValue(0.0));
+    std::string order;
+    store.lookupSignal(x)->subscribe([&](const SignalValue&) { order += 'x'; });
+    store.lookupSignal(y)->subscribe([&](const SignalValue&) { order += 'y'; });
+    store.batchUpdate(std::vector<std::pair<SignalHandle, SignalValue>>{
+        {y, SignalValue(1.0)},
+        {x, SignalValue(1.0)},
+    });
+    store.batchUpdate(std::vector<std::pair<SignalHandle, SignalValue>>{
+        {x, SignalValue(2.0)},
+        {y, SignalValue(2.0)},
+        {x, SignalValue(3.0)},
+    });
+    EXPECT(order == "yxyx");
+
+    // Batches spanning several lock chunks are still applied before the
+    // notification pass
+    std::vector<std::pair<SignalHandle, SignalValue>> large;
+    SignalHandle last;
+    for (size_t i = 0; i < JSISignalStore::kBatchLockChunk * 3 + 1; i++) {
+        last = store.createSignalHandle(SignalValue(0.0));
+        large.emplace_back(last, SignalValue(1.0));
+    }
+    large.emplace_back(a, SignalValue(3.0));
+    seen.clear();
+    store.lookupSignal(a)->subscribe([&](const SignalValue&) {
+        seen.push_back(store.getSignal(last).asNumber());
+    });
+    store.batchUpdate(large);
+    EXPECT(seen.size() == 3 && seen[2] == 1.0);
+}
+
+void testBulkReads() {
+    JSISignalStore& store = freshStore();
+    std::vector<SignalHandle> handles;
+    for (int i = 0; i < 300; i++) {
+        handles.push_back(store.createSignalHandle(SignalValue(static_cast<double>(i))));
+    }
+    SignalHandle stale = handles[7];
+    store.deleteSignal(stale);
+
+    std::vector<SignalHandle> request(handles.rbegin(), handles.rend());
+    request.push_back(SignalHandle());
+    std::vector<SignalValue> values = store.getSignals(request);
+
+    EXPECT(values.size() == 301);
+    EXPECT(values[0].asNumber() == 299.0);
+    EXPECT(values[299].asNumber() == 0.0);
+    EXPECT(values[299 - 7].getType() == SignalValue::Type::Undefined);
+    EXPECT(values[300].getType() == SignalValue::Type::Undefined);
+}
+
+void testVersionBuffer() {
+    JSISignalStore& store = freshStore();
+    SignalHandle handle = store.createSignalHandle(SignalValue(1.0));
+    auto chunk = store.getVersionChunk(handle.slot >> JSISignalStore::VersionBuffer::kChunkShift);
+    EXPECT(chunk != nullptr);
+    if (!chunk) {
+        return;
+    }
+    auto& counter = chunk->items[handle.slot & (JSISignalStore::VersionBuffer::kChunkSize - 1)];
+
+    uint32_t start = counter.load();
+    store.setSignal(handle, SignalValue(1.0));
+    EXPECT(counter.load() == start);
+    store.setSignal(handle, SignalValue(2.0));
+    EXPECT(counter.load() == start + 1);
+
+    // Deleting bumps the slot; writes through a detached Signal don't
+    std::shared_ptr<Signal> detached = store.lookupSignal(handle);
+    store.deleteSignal(handle);
+    EXPECT(counter.load() == start + 2);
+    detached->setValue(SignalValue(3.0));
+    EXPECT(counter.load() == start + 2);
+}
+
+void testNumericSignals() {
+    JSISignalStore& store = freshStore();
+    SignalHandle handle = store.createNumericSignal(1.5);
+    int64_t cell = store.getNumericCell(handle);
+    EXPECT(cell >= 0);
+    EXPECT(store.getNumericCell(store.createSignalHandle(SignalValue(1.0))) == -1);
+    if (cell < 0) {
+        return;
+    }
+    auto chunk = store.getNumericChunk(static_cast<uint32_t>(cell >> JSISignalStore::NumericBuffer::kChunkShift));
+    auto& value = chunk->items[cell & (JSISignalStore::NumericBuffer::kChunkSize - 1)];
+    EXPECT(value.load() == 1.5);
+
+    store.setSignal(handle, SignalValue(42.0));
+    EXPECT(value.load() == 42.0);
+    EXPECT(store.getSignalVersion(handle) == 1);
+
+    bool threw = false;
+    try {
+        store.setSignal(handle, SignalValue("not a number"));
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    EXPECT(threw);
+
+    // A rejected batch writes nothing
+    SignalHandle other = store.createSignalHandle(SignalValue(0.0));
+    threw = false;
+    try {
+        store.batchUpdate(std::vector<std::pair<SignalHandle, SignalValue>>{
+            {other, SignalValue(9.0)},
+            {handle, SignalValue(true)},
+        });
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    EXPECT(threw);
+    EXPECT(store.getSignal(other).asNumber() == 0.0);
+
+    // Freed cells are reused and detached signals stop writing to them
+    std::shared_ptr<Signal> detached = store.lookupSignal(handle);
+    store.deleteSignal(handle);
+    SignalHandle reused = store.createNumericSignal(7.0);
+    EXPECT(store.getNumericCell(reused) == cell);
+    detached->setValue(SignalValue(99.0));
+    EXPECT(value.load() == 7.0);
+}
+
+void testAtomicNumericUpdates() {
+    JSISignalStore& store = freshStore();
+    SignalHandle counter = store.createNumericSignal(0.0);
+    std::atomic<int> notifications{0};
+    store.lookupSignal(counter)->subscribe([&](const SignalValue&) { notifications++; });
+
+    // Concurrent increments never lose updates; one bump per write
+    runProducers(4, [&store, counter](int) {
+        for (int i = 0; i < 500; i++) {
+            store.updateNumber(counter, Signal::NumericOp::Add, 1.0);
+        }
+    });
+    EXPECT(store.getSignal(counter).asNumber() == 2000.0);
+    EXPECT(store.getSignalVersion(counter) == 2000);
+    EXPECT(notifications.load() == 2000);
+
+    // Min/Max that don't change the value don't bump the version
+    EXPECT(store.updateNumber(counter, Signal::NumericOp::Max, 10.0) == 2000.0);
+    EXPECT(store.updateNumber(counter, Signal::NumericOp::Min, 5.0) == 5.0);
+    EXPECT(store.getSignalVersion(counter) == 2001);
+    EXPECT(std::isnan(store.updateNumber(counter, Signal::NumericOp::Max, std::nan(""))));
+    EXPECT(store.updateNumber(counter, Signal::NumericOp::Add, 0.0) != 0.0);  // Still NaN
+
+    SignalHandle zero = store.createNumericSignal(0.0);
+    EXPECT(std::signbit(store.updateNumber(zero, Signal::NumericOp::Min, -0.0)));
+    EXPECT(!std::signbit(store.updateNumber(zero, Signal::NumericOp::Max, 0.0)));
+
+    // compareAndSet only writes against the version it was given
+    uint64_t version = store.getSignalVersion(zero);
+    EXPECT(store.compareAndSet(zero, version, SignalValue(7.0)));
+    EXPECT(!store.compareAndSet(zero, version, SignalValue(8.0)));
+    EXPECT(store.getSignal(zero).asNumber() == 7.0);
+    EXPECT(store.compareAndSet(zero, version + 1, SignalValue(7.0)));
+    EXPECT(store.getSignalVersion(zero) == version + 1);
+
+    // Plain signals work while they hold a number
+    SignalHandle plain = store.createSignalHandle(SignalValue(1.0));
+    EXPECT(store.updateNumber(plain, Signal::NumericOp::Add, 2.0) == 3.0);
+    EXPECT(NumberSignal::attach(plain, store).increment() == 4.0);
+    EXPECT(store.compareAndSet(plain, 2, SignalValue("text")));
+    bool threw = false;
+    try {
+        store.updateNumber(plain, Signal::NumericOp::Add, 1.0);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    EXPECT(threw);
+    EXPECT(store.getSignal(plain).asString() == "text");
+}
+
+void testComputedSignals() {
+    JSISignalStore& store = freshStore();
+    SignalHandle price = store.createSignalHandle(SignalValue(2.0));
+    SignalHandle qty = store.createSignalHandle(SignalValue(3.0));
+
+    int computes = 0;
+    SignalHandle total = store.createComputed({price, qty}, [&](const std::vector<SignalValue>& in) {
+        computes++;
+        return SignalValue(in[0].asNumber() * in[1].asNumber());
+    });
+    SignalHandle positive = store.createComputed({total}, [](const std::vector<SignalValue>& in) {
+        return SignalValue(in[0].asNumber() > 0);
+    });
+    EXPECT(store.getSignal(total).asNumber() == 6.0);
+    EXPECT(store.getSignalVersion(total) == 0);
+    EXPECT(computes == 1);
+
+    // Lazy: writes only mark; the read recomputes once
+    store.setSignal(price, SignalValue(4.0));
+    store.setSignal(qty, SignalValue(5.0));
+    EXPECT(computes == 1);
+    EXPECT(store.getSignal(positive).asBoolean());
+    EXPECT(store.getSignal(total).asNumber() == 20.0);
+    EXPECT(computes == 2);
+
+    // Reading the version alone brings a lazy computed up to date
+    store.setSignal(price, SignalValue(8.0));
+    EXPECT(store.getSignalVersion(total) == 2);
+    EXPECT(computes == 3);
+    store.setSignal(price, SignalValue(4.0));
+    EXPECT(store.lookupSignal(total)->getVersion() == 3);
+
+    // Subscribed: recomputed eagerly; an equal result stops propagation
+    std::vector<double> totals;
+    int positiveChanges = 0;
+    store.lookupSignal(total)->subscribe([&](const SignalValue& value) { totals.push_back(value.asNumber()); });
+    store.lookupSignal(positive)->subscribe([&](const SignalValue&) { positiveChanges++; });
+    store.setSignal(qty, SignalValue(6.0));
+    EXPECT(totals.size() == 1 && totals[0] == 24.0);
+    EXPECT(positiveChanges == 0);
+    EXPECT(store.getSignalVersion(positive) == 0);
+
+    // A batch is seen whole: one recompute, one notification
+    store.batchUpdate(std::vector<std::pair<SignalHandle, SignalValue>>{
+        {price, SignalValue(1.0)},
+        {qty, SignalValue(7.0)},
+    });
+    EXPECT(totals.size() == 2 && totals[1] == 7.0);
+
+    bool threw = false;
+    try {
+        store.setSignal(total, SignalValue(1.0));
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    EXPECT(threw);
+
+    // Deleted computeds stop following their inputs
+    store.deleteSignal(total);
+    store.setSignal(price, SignalValue(10.0));
+    EXPECT(totals.size() == 2);
+    EXPECT(store.getSignal(positive).asBoolean());
+}
+
+SignalValue evaluate(const char* source, const std::vector<SignalValue>& inputs = {}) {
+    return Expression::compile(source).evaluate(inputs);
+}
+
+void testExpressions() {
+    Expression total = Expression::compile("price * qty");
+    EXPECT(total.variables().size() == 2 && total.variables()[1] == "qty");
+    EXPECT(total.evaluate({SignalValue(2.5), SignalValue(4.0)}).asNumber() == 10.0);
+
+    Expression isValid = Expression::compile("len(name) > 0 && age >= 18");
+    EXPECT(isValid.evaluate({SignalValue("Ada"), SignalValue(36.0)}).asBoolean());
+    EXPECT(!isValid.evaluate({SignalValue(""), SignalValue(36.0)}).asBoolean());
+    EXPECT(!isValid.evaluate({SignalValue("Ada"), SignalValue(12.0)}).asBoolean());
+
+    EXPECT(evaluate("1 + 2 * 3 - -4 % 3").asNumber() == 8.0);
+    EXPECT(evaluate("(1 + 2) * 3").asNumber() == 9.0);
+    EXPECT(evaluate("clamp(15, 0, 10) + min(3, 1, 2) + max(-1, 4)").asNumber() == 15.0);
+    EXPECT(evaluate("round(2.5) + round(-2.5) + floor(1.7) + abs(-3)").asNumber() == 5.0);
+    EXPECT(evaluate("n == 1 ? '1 item' : n + ' items'", {SignalValue(3.0)}).asString() == "3 items");
+    EXPECT(evaluate("'x' + 0.1 + 1e21 + true + null").asString() == "x0.11e+21truenull");
+    EXPECT(evaluate("'b' > 'a' && '10' < 9 == false").asBoolean());
+    EXPECT(evaluate("0 || '' || 'fallback'").asString() == "fallback");
+    EXPECT(evaluate("missing && 1").getType() == SignalValue::Type::Undefined);
+    EXPECT(std::isnan(evaluate("'abc' * 2").asNumber()));
+    EXPECT(evaluate("0x1F + 0o17 + 0b11 + 1.5e1 + .5").asNumber() == 64.5);
+    EXPECT(std::isinf(evaluate("1e400").asNumber()));
+    EXPECT(evaluate("' -12.5 ' * 2").asNumber() == -25.0);
+    EXPECT(evaluate("'0x10' * 1").asNumber() == 16.0);
+    EXPECT(std::isnan(evaluate("'0x1p3' * 1").asNumber()));
+    EXPECT(std::isnan(evaluate("'-0x10' * 1").asNumber()));
+    EXPECT(std::isnan(evaluate("'1e' * 1").asNumber()));
+    EXPECT(evaluate("len(s)", {SignalValue("caf\xc3\xa9 \xf0\x9f\x8e\x89")}).asNumber() == 7.0);
+
+    const char* invalid[] = {"", "1 +", "(1", "a ? b", "foo(1)", "clamp(1, 2)", "1 @ 2", "'open",
+                             "0x1p3", "012", "1e", "0b12", "1px"};
+    for (const char* source : invalid) {
+        bool threw = false;
+        try {
+            Expression::compile(source);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        EXPECT(threw);
+    }
+
+    // Nesting is bounded instead of overflowing the stack
+    bool threw = false;
+    try {
+        Expression::compile(std::string(10000, '(') + "1" + std::string(10000, ')'));
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    EXPECT(threw);
+
+    // As a computed signal
+    JSISignalStore& store = freshStore();
+    SignalHandle price = store.createSignalHandle(SignalValue(2.0));
+    SignalHandle qty = store.createSignalHandle(SignalValue(3.0));
+    SignalHandle computed = store.createComputed({price, qty}, [total](const std::vector<SignalValue>& inputs) {
+        return total.evaluate(inputs);
+    });
+    store.setSignal(qty, SignalValue(5.0));
+    EXPECT(store.getSignal(computed).asNumber() == 10.0);
+}
+
+void testCoalescedNotifier() {
+    JSISignalStore& store = freshStore();
+    SignalHandle a = store.createSignalHandle(SignalValue(0.0));
+    SignalHandle b = store.createSignalHandle(SignalValue(0.0));
+
+    std::vector<std::function<void()>> tasks;
+    std::mutex tasksMutex;
+    std::vector<std::pair<char, double>> delivered;
+    {
+        CoalescedNotifier notifier([&](std::function<void()> task) {
+            std::lock_guard<std::mutex> lock(tasksMutex);
+            tasks.push_back(std::move(task));
+        });
+        notifier.subscribe(store.lookupSignal(a), [&](const SignalValue& value) {
+            delivered.emplace_back('a', value.asNumber());
+        });
+        uint64_t bId = notifier.subscribe(store.lookupSignal(b), [&](const SignalValue& value) {
+            delivered.emplace_back('b', value.asNumber());
+        });
+
+        // A burst from a producer thread: one task, latest value per signal
+        runProducers(1, [&](int) {
+            for (int i = 1; i <= 100; i++) {
+                store.setSignal(b, SignalValue(static_cast<double>(i)));
+                store.setSignal(a, SignalValue(static_cast<double>(-i)));
+            }
+        });
+        EXPECT(tasks.size() == 1);
+        EXPECT(delivered.empty());
+        tasks[0]();
+        EXPECT(delivered.size() == 2);
+        EXPECT(delivered.size() == 2 && delivered[0] == std::make_pair('b', 100.0));
+        EXPECT(delivered.size() == 2 && delivered[1] == std::make_pair('a', -100.0));
+
+        // Unsubscribing drops changes that are already queued
+        store.setSignal(b, SignalValue(1.0));
+        EXPECT(notifier.unsubscribe(bId));
+        EXPECT(!notifier.unsubscribe(bId));
+        EXPECT(tasks.size() == 2);
+        tasks[1]();
+        EXPECT(delivered.size() == 2);
+
+        store.setSignal(a, SignalValue(1.0));
+        EXPECT(tasks.size() == 3);
+    }
+
+    // A flush scheduled before the notifier went away does nothing
+    tasks[2]();
+    EXPECT(delivered.size() == 2);
+    EXPECT(store.lookupSignal(a)->getSubscriberCount() == 0);
+}
+
+void testWriteQueue() {
+    JSISignalStore& store = freshStore();
+    SignalHandle a = store.createSignalHandle(SignalValue(0.0));
+    SignalHandle numeric = store.createNumericSignal(0.0);
+
+    std::atomic<int> wakeups{0};
+    WriteQueue coalescing(store, WriteQueue::Mode::Coalesce, [&] { wakeups++; });
+    int notifications = 0;
+    store.lookupSignal(a)->subscribe([&](const SignalValue&) { notifications++; });
+
+    runProducers(4, [&coalescing, a](int t) {
+        for (int i = 0; i < 500; i++) {
+            coalescing.enqueue(a, SignalValue(static_cast<double>(t * 1000 + i)));
+        }
+    });
+    // Subscribers only run on the draining thread
+    EXPECT(notifications == 0);
+    EXPECT(wakeups.load() == 1);
+
+    coalescing.enqueue(a, SignalValue(-1.0));
+    coalescing.enqueue(numeric, SignalValue("rejected"));
+    EXPECT(coalescing.drain() == 2002);
+    EXPECT(coalescing.empty());
+    EXPECT(notifications == 1);
+    EXPECT(store.getSignal(a).asNumber() == -1.0);
+    EXPECT(coalescing.getRejectedCount() == 1);
+
+    WriteQueue sequential(store, WriteQueue::Mode::Sequential);
+    for (int i = 1; i <= 3; i++) {
+        sequential.enqueue(a, SignalValue(static_cast<double>(i)));
+    }
+    EXPECT(sequential.drain() == 3);
+    EXPECT(notifications == 4);
+    EXPECT(store.getSignal(a).asNumber() == 3.0);
+
+    // Nodes drained on one thread are recycled by producers on others
+    std::atomic<bool> done{false};
+    std::atomic<size_t> taken{0};
+    std::thread consumer = startReader(done, [&] { taken += coalescing.drain(); });
+    runProducers(4, [&coalescing, a](int t) {
+        for (int i = 0; i < 2000; i++) {
+            coalescing.enqueue(a, SignalValue(static_cast<double>(t * 10000 + i)));
+        }
+    });
+    done = true;
+    if (consumer.joinable()) {
+        consumer.join();
+    }
+    taken += coalescing.drain();
+    EXPECT(taken.load() == 8000);
+    EXPECT(std::fmod(store.getSignal(a).asNumber(), 10000.0) == 1999.0);
+}
+
+void testTypedNativeSignals() {
+    JSISignalStore& store = freshStore();
+
+    NumberSignal number = NumberSignal::create(1.5, store);
+    EXPECT(store.getNumericCell(number.handle()) >= 0);
+    EXPECT(number.get() == 1.5);
+    EXPECT(!number.set(1.5));
+    EXPECT(number.set(2.5));
+    EXPECT(number.version() == 1);
+    EXPECT(store.getSignal(number.id()).asNumber() == 2.5);
+
+    // Handles resolve once and can be shared across producer threads
+    runProducers(4, [number](int t) mutable {
+        for (int i = 0; i < 500; i++) {
+            number.set(static_cast<double>(t * 1000 + i));
+        }
+    });
+    EXPECT(std::fmod(number.get(), 1000.0) == 499.0);
+
+    StringSignal text = StringSignal::create("idle", store);
+    EXPECT(text.set("a string long enough to leave inline storage"));
+    EXPECT(StringSignal::attach(text.handle(), store).get() == "a string long enough to leave inline storage");
+
+    const uint8_t frame[] = {1, 2, 3, 4};
+    BufferSignal buffer = BufferSignal::create(frame, sizeof(frame), BufferSignal::Kind::Uint8Array, store);
+    auto owner = std::make_shared<std::vector<uint8_t>>(8, uint8_t{7});
+    EXPECT(buffer.set(owner, owner->data(), owner->size()));
+    buffer.read([&](BufferSignal::View view) {
+        EXPECT(view.data == owner->data());
+        EXPECT(view.size == 8);
+    });
+
+    // attach rejects missing, computed and mismatched signals
+    SignalHandle computed = store.createComputed({number.handle()}, [](const std::vector<SignalValue>& inputs) {
+        return inputs[0];
+    });
+    SignalHandle label = store.createSignalHandle(SignalValue("label"));
+    auto throws = [](auto attach) {
+        try {
+            attach();
+        } catch (const std::exception&) {
+            return true;
+        }
+        return false;
+    };
+    EXPECT(throws([&] { NumberSignal::attach(computed, store); }));
+    EXPECT(throws([&] { NumberSignal::attach(label, store); }));
+    EXPECT(throws([&] { StringSignal::attach(number.handle(), store); }));
+
+    store.deleteSignal(label);
+    EXPECT(throws([&] { BufferSignal::attach(label, store); }));
+    EXPECT(number.isAlive());
+    store.deleteSignal(number.handle());
+    EXPECT(!number.isAlive());
+}
+
+void testCompileTimeTypedSignals() {
+    TypedSignal<double> number(0.0);
+    std::vector<double> seen;
+    size_t id = number.subscribe([&](const double& value) { seen.push_back(value); });
+    EXPECT(number.set(1.5));
+    EXPECT(!number.set(1.5));
+    EXPECT(number.set(-0.0));
+    EXPECT(number.set(std::nan("")));
+    EXPECT(!number.set(std::nan("")));
+    EXPECT(number.getVersion() == 3);
+    EXPECT(seen.size() == 3);
+    number.unsubscribe(id);
+    EXPECT(number.getSubscriberCount() == 0);
+
+    TypedSignal<int64_t> counter(int64_t{1} << 40);
+    EXPECT(counter.toValue().asNumber() == 1099511627776.0);
+    TypedSignal<bool> flag(false);
+    EXPECT(flag.set(true) && flag.get());
+
+    TypedSignal<std::string> text("idle");
+    EXPECT(text.set("a string long enough to leave inline storage"));
+    EXPECT(!text.set("a string long enough to leave inline storage"));
+    EXPECT(text.read([](const std::string& value) { return value.size(); }) == 44);
+    EXPECT(text.toValue().asString() == "a string long enough to leave inline storage");
+
+    // Equal contents in different memory are not a change; toValue aliases
+    const uint8_t bytes[] = {1, 2, 3};
+    TypedSignal<SignalBuffer> buffer(SignalBuffer::copy(bytes, sizeof(bytes)));
+    EXPECT(!buffer.set(SignalBuffer::copy(bytes, sizeof(bytes))));
+    SignalBuffer frame = SignalBuffer::copy(bytes, 2, SignalValue::BinaryKind::Uint8Array);
+    EXPECT(buffer.set(frame));
+    EXPECT(buffer.toValue().asBinary().data == frame.data);
+
+    // Concurrent writers and lock-free readers
+    std::atomic<bool> done{false};
+    std::thread reader = startReader(done, [&] {
+        text.read([](const std::string& value) { return value.size(); });
+    });
+    runProducers(4, [&](int t) {
+        for (int i = 0; i < 500; i++) {
+            number.set(static_cast<double>(t * 1000 + i));
+            text.set(std::to_string(i));
+        }
+    });
+    done.store(true);
+    if (reader.joinable()) {
+        reader.join();
+    }
+    EXPECT(std::fmod(number.get(), 1000.0) == 499.0);
+    EXPECT(text.get() == "499");
+}
+
+void testPoolReuse() {
+    JSISignalStore& store = freshStore();
+    std::vector<SignalHandle> handles;
+    for (int i = 0; i < 2000; i++) {
+        handles.push_back(store.createSignalHandle(SignalValue(static_cast<double>(i))));
+    }
+    SlabPool::Stats filled = store.getSignalPoolStats();
+    EXPECT(filled.liveBlocks == 2000);
+
+    for (SignalHandle handle : handles) {
+        store.deleteSignal(handle);
+    }
+    EXPECT(store.getSignalPoolStats().liveBlocks == 0);
+
+    for (int i = 0; i < 2000; i++) {
+        store.createSignalHandle(SignalValue(static_cast<double>(i)));
+    }
+    EXPECT(store.getSignalPoolStats().slabCount == filled.slabCount);
+}
+
+void testConcurrentReadersAndWriters() {
+    JSISignalStore& store = freshStore();
+    SignalHandle handle = store.createSignalHandle(SignalValue(0.0));
+    std::atomic<bool> done{false};
+    std::atomic<int> badReads{0};
+
+    std::thread reader = startReader(done, [&] {
+        double value = store.getSignal(handle).asNumber();
+        if (value < 0 || value > 1000) {
+            badReads++;
+        }
+    });
+
+    runProducers(2, [&store, handle](int) {
+        for (int i = 1; i <= 1000; i++) {
+            store.setSignal(handle, SignalValue(static_cast<double>(i)));
+            SignalHandle scratch = store.createSignalHandle(SignalValue(1.0));
+            store.deleteSignal(scratch);
+        }
+    });
+    done = true;
+    if (reader.joinable()) {
+        reader.join();
+    }
+
+    EXPECT(badReads.load() == 0);
+    EXPECT(store.getSignal(handle).asNumber() == 1000.0);
+}
+
+} // namespace
+
+int main() {
+    const TestCase tests[] = {
+        {"value representation", testValueRepresentation},
+        {"Object.is equality", testObjectIsEquality},
+        {"binary values", testBinaryValues},
+        {"handles and string IDs", testHandlesAndIds},
+        {"unchanged writes are skipped", testUnchangedWritesAreSkipped},
+        {"batch notifies once", testBatchNotifiesOnce},
+        {"bulk reads", testBulkReads},
+        {"version buffer", testVersionBuffer},
+        {"numeric signals", testNumericSignals},
+        {"atomic numeric updates", testAtomicNumericUpdates},
+        {"computed signals", testComputedSignals},
+        {"expressions", testExpressions},
+        {"coalesced notifier", testCoalescedNotifier},
+        {"write queue", testWriteQueue},
+        {"typed native signals", testTypedNativeSignals},
+        {"compile-time typed signals", testCompileTimeTypedSignals},
+        {"pool reuse", testPoolReuse},
+        {"concurrent readers and writers", testConcurrentReadersAndWriters},
+    };
+
+    for (const TestCase& test : tests) {
+        int before = failures;
+        test.run();
+        std::printf("%s %s\n", failures == before ? "PASS" : "FAIL", test.name);
+    }
+
+    JSISignalStore::getInstance().clear();
+    return failures == 0 ? 0 : 1;
+}